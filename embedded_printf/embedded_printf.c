@@ -120,6 +120,84 @@
 #define FLAG_USE_ZERO_PADDING	(0x2)
 #define FLAG_IS_NOT_FIRST_DIGIT (0x4)
 
+/*
+ * The tiny engine is compiled when it's selected, or as reference to check
+ * the table engine against.
+ */
+#if (EMBPF_DIGIT_ENGINE_TINY == EMBPF_DIGIT_ENGINE) ||						\
+	(1 == EMBPF_VERIFY_DIGIT_ENGINE)
+	#define EMBPF_USE_TINY_ENGINE		(1)
+#else
+	#define EMBPF_USE_TINY_ENGINE		(0)
+#endif
+
+#if (1 == EMBPF_USE_KEY_VALUE)
+/*
+ * Strings are scanned for characters that need escaping one 32bits word (4
+ * characters) at a time. Reading a uint8_t string through a uint32_t pointer
+ * breaks the C aliasing rules, the may_alias attribute tells GCC it's on
+ * purpose.
+ */
+typedef uint32_t __attribute__((__may_alias__)) embpf_word_t;
+
+/*
+ * Non-zero when any of the 4 characters in the word is smaller than value.
+ * The classic 'has zero byte' trick: subtracting value from a character below
+ * it borrows and sets bit 7, while '& ~word' filters characters that already
+ * had bit 7 set.
+ */
+#define WORD_HAS_CHARACTER_BELOW(word, value)								\
+			(((word) - (0x01010101u * (value))) & ~(word) & 0x80808080u)
+
+/* Non-zero when any of the 4 characters in the word equals character */
+#define WORD_HAS_CHARACTER(word, character)									\
+			WORD_HAS_CHARACTER_BELOW((word) ^ (0x01010101u * (character)), 1u)
+
+#endif /* EMBPF_USE_KEY_VALUE */
+
+#if (1 == EMBPF_USE_RATE_LIMIT)
+/*
+ * Atomic operations used by the rate limiter. By default the GCC builtins are
+ * used. Cores without exclusive load/store (e.g. Cortex-M0) can map these to
+ * their own implementation, e.g. one that briefly disables interrupts.
+ */
+#ifndef EMBPF_ATOMIC_FETCH_ADD
+	#define EMBPF_ATOMIC_FETCH_ADD(pointer, value)							\
+				__atomic_fetch_add((pointer), (value), __ATOMIC_RELAXED)
+#endif
+
+#ifndef EMBPF_ATOMIC_LOAD
+	#define EMBPF_ATOMIC_LOAD(pointer)										\
+				__atomic_load_n((pointer), __ATOMIC_ACQUIRE)
+#endif
+
+#ifndef EMBPF_ATOMIC_EXCHANGE
+	#define EMBPF_ATOMIC_EXCHANGE(pointer, value)							\
+				__atomic_exchange_n((pointer), (value), __ATOMIC_ACQ_REL)
+#endif
+
+#ifndef EMBPF_ATOMIC_COMPARE_EXCHANGE
+	#define EMBPF_ATOMIC_COMPARE_EXCHANGE(pointer, expectedPtr, desired)	\
+				__atomic_compare_exchange_n((pointer), (expectedPtr),		\
+						(desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+#endif
+
+/*
+ * States of embpf_rateLimit_t.isRegistered. The token bucket of a site is
+ * only used once it is initialised, i.e. the site is ready.
+ */
+#define RATE_LIMIT_UNREGISTERED	(0u)
+#define RATE_LIMIT_REGISTERING	(1u)
+#define RATE_LIMIT_READY		(2u)
+
+/*
+ * Largest number of ticks theoreticalArrival can be ahead of the tick counter
+ * (burst * ticksPerToken). It must fit in 31 bits, as the distance is compared
+ * as a signed value.
+ */
+#define RATE_LIMIT_MAX_TICKS_AHEAD	(0x7FFFFFFFu)
+#endif /* EMBPF_USE_RATE_LIMIT */
+
 
 /*******************************************************************************
  * Variables
@@ -146,6 +224,56 @@ static uint8_t * outputBufferPtr;
 /* Variable to hold internal flags */
 static uint8_t embpf_InternalFlags = 0u;
 
+#if (EMBPF_DIGIT_ENGINE_TABLE == EMBPF_DIGIT_ENGINE)
+/* All numbers 00 - 99 as 2 characters, without '\0' terminators */
+static const uint8_t decimalDigitPairs[200] =
+{
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899"
+};
+
+/* The hexadecimal digits for %x and %X */
+static const uint8_t hexDigitsSmall[16] = "0123456789abcdef";
+static const uint8_t hexDigitsCapital[16] = "0123456789ABCDEF";
+#endif /* EMBPF_DIGIT_ENGINE_TABLE */
+
+#if (1 == EMBPF_USE_TINY_ENGINE) && (0 == EMBPF_TINY_ENGINE_UNROLLED)
+/* Powers of 10 and 16 the tiny engine divides by, ending with the 1s */
+static const uint32_t decimalDivisors[10] =
+{
+	1000000000u, 100000000u, 10000000u, 1000000u, 100000u,
+	10000u, 1000u, 100u, 10u, 1u
+};
+
+static const uint32_t hexadecimalDivisors[8] =
+{
+	0x10000000u, 0x1000000u, 0x100000u, 0x10000u, 0x1000u, 0x100u, 0x10u, 1u
+};
+#endif
+
+#if (1 == EMBPF_VERIFY_DIGIT_ENGINE)
+/* buffer for the tiny engine result to check the table engine against */
+static uint8_t verifyBuffer[12];
+#endif
+
+#if (1 == EMBPF_USE_RATE_LIMIT)
+/* Rate limit settings, shared by all call sites and tunable at runtime */
+static volatile uint32_t embpf_RateLimitSampleRate = 1u;
+static volatile uint32_t embpf_RateLimitTicksPerToken = 0u;
+static volatile uint32_t embpf_RateLimitBurst = 1u;
+
+/* List of all call sites that have been called at least once */
+static embpf_rateLimit_t * embpf_RateLimitCallSites = 0;
+#endif /* EMBPF_USE_RATE_LIMIT */
+
 
 /*******************************************************************************
  * Private function declaration
@@ -167,6 +295,7 @@ static void putInOutputBuffer(uint8_t character);
  * 					  			a hexadecimal unsigned integer value between 0
  * 					  			and 15
  */
+#if (1 == EMBPF_USE_TINY_ENGINE)
 static void putDigitInOutputBuffer(uint8_t digit);
 
 /*!
@@ -177,6 +306,121 @@ static void putDigitInOutputBuffer(uint8_t digit);
  */
 static void divideAndPutInOutputBuffer(uint32_t * number, uint32_t dividend);
 
+/*!
+ * @description Puts the decimal digits of a number into the output buffer
+ *
+ * @param [in] number 			the (absolute) value to format
+ */
+static void putDecimalInOutputBuffer(uint32_t number);
+
+/*!
+ * @description Puts the hexadecimal digits of a number into the output buffer
+ *
+ * @param [in] number 			the value to format
+ */
+static void putHexadecimalInOutputBuffer(uint32_t number);
+
+#if (0 == EMBPF_TINY_ENGINE_UNROLLED)
+/*!
+ * @description Puts the digits of a number into the output buffer by dividing
+ * it by each of the divisors in turn
+ *
+ * @param [in] number 			the value to format
+ * @param [in] divisors 		powers of the base, largest first, ending with 1
+ */
+static void putDigitsInOutputBuffer(uint32_t number, const uint32_t * divisors);
+#endif
+#endif
+
+#if (EMBPF_DIGIT_ENGINE_TABLE == EMBPF_DIGIT_ENGINE)
+/*!
+ * @description Puts the decimal digits of a number at the end of the output
+ * buffer, preceded by the '-' sign if that is already in the buffer
+ *
+ * @param [in] number 			the (absolute) value to format
+ * @return						the formatted, '\0' terminated, string
+ */
+static uint8_t * formatDecimal(uint32_t number);
+
+/*!
+ * @description Puts the hexadecimal digits of a number at the end of the
+ * output buffer
+ *
+ * @param [in] number 			the value to format
+ * @return						the formatted, '\0' terminated, string
+ */
+static uint8_t * formatHexadecimal(uint32_t number);
+#endif
+
+#if (1 == EMBPF_VERIFY_DIGIT_ENGINE)
+/*!
+ * @description Formats a number with the tiny engine and ASSERTs that the
+ * result equals that of the table engine
+ *
+ * @param [in] formatted 		the result of the table engine
+ * @param [in] number 			the (absolute) value that was formatted
+ * @param [in] isNegative 		1 when a '-' must precede the digits
+ * @param [in] isHexadecimal 	1 for hexadecimal, 0 for decimal
+ */
+static void verifyDigitEngine(const uint8_t * formatted, uint32_t number,
+							  uint8_t isNegative, uint8_t isHexadecimal);
+#endif
+
+/*!
+ * @description Evaluates the flags and width of a format tag and sets the
+ * internal flags accordingly
+ *
+ * @param [in]  format 			pointer to the character following the '%'
+ * @param [out] formatWidth		the width found in the format tag
+ * @return						pointer to the specifier
+ */
+static const uint8_t * parseFormatTag(const uint8_t * format,
+									  uint8_t * formatWidth);
+
+/*!
+ * @description Takes the next argument from the list and formats it according
+ * to the specifier
+ *
+ * @param [in] specifier 		the format specifier, e.g. 'd'
+ * @param [in] arguments 		the variable length argument list
+ * @return						the formatted, '\0' terminated, string
+ */
+static uint8_t * formatArgument(uint8_t specifier, va_list * arguments);
+
+/*!
+ * @description Puts the zeros or spaces needed to fill up the width to the
+ * output function
+ *
+ * @param [in] string 			the formatted string that will follow
+ * @param [in] formatWidth 		the width of the format tag
+ */
+static void putPadding(const uint8_t * string, uint8_t formatWidth);
+
+/*!
+ * @description Passes a string to the output function
+ *
+ * @param [in] string 			the '\0' terminated string
+ */
+static void putString(const uint8_t * string);
+
+#if (1 == EMBPF_USE_KEY_VALUE)
+/*!
+ * @description Passes a character to the output function, escaped as needed
+ * inside a JSON string
+ *
+ * @param [in] character 		the character to be put to the output
+ */
+static void putEscapedCharacter(uint8_t character);
+
+/*!
+ * @description Passes a string to the output function, escaped as needed
+ * inside a JSON string
+ *
+ * @param [in] string 			the '\0' terminated string
+ */
+static void putEscapedString(const uint8_t * string);
+#endif /* EMBPF_USE_KEY_VALUE */
+
 
 
 /*******************************************************************************
@@ -210,9 +454,6 @@ void embedded_printf(const uint8_t *format, ...)
 	/* Variable to keep track of the width */
 	uint8_t formatWidth = 0u;
 
-	/* temporary value to pass a number for formatting */
-	static uint32_t u32integerNumber;
-
 	/* Clear all flags */
 	embpf_InternalFlags = 0u;
 
@@ -239,208 +480,22 @@ void embedded_printf(const uint8_t *format, ...)
 		/* When a '%' is encountered it means formatting is required. */
 		else
 		{
-			/* Clear all flags before formatting the current character */
-			embpf_InternalFlags = 0u;
-
-			/* Clear width variable too */
-			formatWidth = 0u;
-
-			/* Get next character (i.e. the one following the '%') */
-			currentCharacter = *(format++);
-
-			/*
-			 *	Check if the current character is a '0'. if so, set a flag
-			 *	indicating zero padding must be done.
-			 *	Then get the next character.
-			 */
-			if('0' == currentCharacter)
-			{
-				embpf_InternalFlags |= FLAG_USE_ZERO_PADDING;
-				currentCharacter = *(format++);
-			}
-
-			/*
-			 * See if there is a character between '0' and '9'. If so, this
-			 * specifies the width.
-			 */
-			if(('0' <= currentCharacter) && ('9' >= currentCharacter))
-			{
-				/*
-				 * For every decimal number, the previous width must be *10.
-				 * Then add the newly found value. (Starting at width = 0u)
-				 * Repeat until no characters between '0' and '9' are found.
-				 */
-				while(('0' <= currentCharacter) && ('9' >= currentCharacter))
-				{
-					/*
-					 * Shifting is faster and smaller than multiplication so:
-					 * formatWidth*10 is done as follows:
-					 * 1) Shift left by 2. This is the same as *4
-					 * 2) Add its original self. To the result: Now we have *5
-					 * 3) Shift left by 1. This is the same as *2. Now the total
-					 * 	  is *10
-					 */
-					formatWidth = (((formatWidth << 2u) + formatWidth) << 1u);
-
-					/* Add integer value of current decimal character */
-					formatWidth += (currentCharacter - '0');
-
-					currentCharacter = *(format++);
-				}
-			}
-
-			outputBufferPtr = outputBuffer;
-			outputStringPtr	= outputBuffer;
+			/* Get the flags and width, format then points to the specifier */
+			format = parseFormatTag(format, &formatWidth);
 
-			/* Now determine the specifier and act accordingly */
-			switch(currentCharacter)
-			{
-				case 'u':
-				case 'i':
-				case 'd':
-					u32integerNumber = va_arg(arguments, uint32_t);
-
-					/* Check if integer is actually signed */
-					if(('d' == currentCharacter) || ('i' == currentCharacter))
-					{
-						/*
-						 * Check if the signed integer < 0
-						 * If so take 2's complement and put a '-' sign to the
-						 * outputBuffer
-						 */
-						if((int32_t)u32integerNumber < 0)
-						{
-							u32integerNumber = ((~u32integerNumber) + 1u);
-							putInOutputBuffer('-');
-						}
-					}
-
-					/*
-					 * Now to determine all digits that are in the integer.
-					 * Say we have a number of 654321. Somehow we need to get
-					 * the 6 first, then the 5, then the 4 etc..
-					 *
-					 * Now let's subtract 100000 from the number and count how
-					 * many times we can do that until the remainder is smaller
-					 * than 100000.
-					 *
-					 * We end up with a count of 6 and a remainder of 54321
-					 * The count is our first digit and can be put into the
-					 * output buffer.
-					 *
-					 * Now repeat this with a dividend of 10000. We end up with
-					 * a count of 5 and a remainder of 4321.
-					 *
-					 * See where we're going?
-					 *
-					 * We can stop dividing after we did the 10s. As only the
-					 * 1s are left and they can be put directly into the output
-					 * buffer.
-					 *
-					 * Now for a 32bits integer we need to start dividing by
-					 * 1.000.000.000
-					 *
-					 */
-					divideAndPutInOutputBuffer(&u32integerNumber, 1000000000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,  100000000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,   10000000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,    1000000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,     100000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,      10000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,       1000u);
-					divideAndPutInOutputBuffer(&u32integerNumber,        100u);
-					divideAndPutInOutputBuffer(&u32integerNumber,         10u);
-					putDigitInOutputBuffer(u32integerNumber);
-
-					break;
-
-				case 'x':
-				case 'X':
-					if('X' == currentCharacter)
-					{
-						embpf_InternalFlags |= FLAG_HEX_USE_CAPITALS;
-					}
-
-					u32integerNumber = va_arg(arguments, uint32_t);
-
-					/*
-					 * The principle of getting the digits out is the same as
-					 * above with the decimal integers. Now however we need to
-					 * divide by powers of 16.
-					 *
-					 * For a 32bits hexadecimal value we start to divide with
-					 * 0x10000000
-					 */
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x10000000);
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x1000000);
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x100000);
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x10000);
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x1000);
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x100);
-					divideAndPutInOutputBuffer(&u32integerNumber, 0x10);
-					putDigitInOutputBuffer(u32integerNumber);
-					break;
-
-				case 'c':
-					/*
-					 * Get the character from the arguments list and put it into
-					 * the buffer
-					 */
-					putInOutputBuffer((uint8_t)(va_arg(arguments, uint32_t)));
-					break;
-
-				case 's':
-					/*
-					 * The variable is already a string, so set the
-					 * outputStringPtr to this string instead
-					 */
-					outputStringPtr = (uint8_t *)(va_arg(arguments, uint8_t *));
-					break;
-
-				case '%':
-					putInOutputBuffer('%');
-					break;
-
-				default:
-					break;
-			} /* switch(currentCharacter) */
-
-			/* Add string terminator to buffer */
-			*outputBufferPtr = '\0';
-			outputBufferPtr = outputStringPtr;
-
-			/* Subtract the buffered string length from the formatWidth */
-			while((*(outputBufferPtr++)) && (formatWidth > 0u))
-			{
-				formatWidth--;
-			}
+			/* Get the specifier and format the matching argument */
+			currentCharacter = *format;
+			outputStringPtr = formatArgument(currentCharacter, &arguments);
 
-			/*
-			 * If the width > string: put the required zeros or spaces to the
-			 * output function
-			 */
-			while(formatWidth-- > 0u)
+			/* Don't step over the end of a format ending with a '%' */
+			if(currentCharacter)
 			{
-				if(embpf_InternalFlags & FLAG_USE_ZERO_PADDING)
-				{
-					embedded_putChar('0');
-				}
-				else
-				{
-					embedded_putChar(' ');
-				}
+				format++;
 			}
 
-			/*
-			 * Pass the formatted string to the output function, one character
-			 * at at time
-			 */
-			currentCharacter = *(outputStringPtr++);
-			while(currentCharacter)
-			{
-				embedded_putChar(currentCharacter);
-				currentCharacter = *(outputStringPtr++);
-			}
+			/* Pass the padding and the formatted string to the output */
+			putPadding(outputStringPtr, formatWidth);
+			putString(outputStringPtr);
 
 		} /* '%' == currentCharacter */
 
@@ -455,89 +510,1113 @@ void embedded_printf(const uint8_t *format, ...)
 	return;
 }
 
-
-/*******************************************************************************
- * Private functions
- ******************************************************************************/
-
+#if (1 == EMBPF_USE_KEY_VALUE)
 
 /*FUNCTION**********************************************************************
  *
- * Function Name : putInOutputBuffer
- * Description   : Puts a character into the output buffer string and increases
- * 				   the position pointer by 1
+ * Function Name : embedded_printf_kv
+ * Description   : Prints key=value pairs as a JSON object.
+ *
+ * Comments:
+ * - Everything is passed to the output while the format is evaluated. The
+ *   formatted values are escaped on their way out, so there is no need to
+ *   format into a buffer first and escape it in a second pass.
+ * - A value is printed as a JSON number only when it is exactly one %d, %i
+ *   or %u without width. A width may add zero padding, which is not allowed
+ *   in a JSON number.
  *
  *END**************************************************************************/
-static void putInOutputBuffer(uint8_t character)
+void embedded_printf_kv(const uint8_t *event, const uint8_t *format, ...)
 {
-	*(outputBufferPtr++) = character;
+	/* Variable to contain the list of arguments */
+	va_list arguments;
+
+	/* Variable to temporarily contain the character that is evaluated */
+	uint8_t currentCharacter;
+
+	/* Pointer to the formatted string of a format tag */
+	uint8_t * outputStringPtr;
+
+	/* Variable to keep track of the width */
+	uint8_t formatWidth = 0u;
+
+	/* Set when the current value is printed as a JSON number */
+	uint8_t isNumber;
+
+	/* Initialize the pointer to the variable length argument list. */
+	va_start(arguments, format);
+
+	/* The event name is always the first field */
+	putString((const uint8_t *)"{\"event\":\"");
+	putEscapedString(event);
+	embedded_putChar('"');
+
+	currentCharacter = *format;
+
+	while(currentCharacter)
+	{
+		/* Skip the spaces between the key=value pairs */
+		if(' ' == currentCharacter)
+		{
+			currentCharacter = *(++format);
+			continue;
+		}
+
+		/* Pass the key to the output, up to the '=' */
+		putString((const uint8_t *)",\"");
+		while((currentCharacter) && ('=' != currentCharacter) &&
+			  (' ' != currentCharacter))
+		{
+			embedded_putChar(currentCharacter);
+			currentCharacter = *(++format);
+		}
+		putString((const uint8_t *)"\":");
+
+		/* Skip the '=' (a key without one gets an empty value) */
+		if('=' == currentCharacter)
+		{
+			currentCharacter = *(++format);
+		}
+
+		/* Check if the value is a plain decimal integer */
+		isNumber = 0u;
+		if(('%' == currentCharacter) &&
+		   (('d' == format[1]) || ('i' == format[1]) || ('u' == format[1])) &&
+		   ((' ' == format[2]) || ('\0' == format[2])))
+		{
+			isNumber = 1u;
+		}
+
+		if(0u == isNumber)
+		{
+			embedded_putChar('"');
+		}
+
+		/* Pass the value to the output, up to the next space */
+		while((currentCharacter) && (' ' != currentCharacter))
+		{
+			if('%' != currentCharacter)
+			{
+				putEscapedCharacter(currentCharacter);
+			}
+			else
+			{
+				/* Same as embedded_printf(), see there */
+				format = parseFormatTag(format + 1, &formatWidth);
+
+				currentCharacter = *format;
+				outputStringPtr = formatArgument(currentCharacter, &arguments);
+
+				/* Don't step over the end of a format ending with a '%' */
+				if(currentCharacter)
+				{
+					format++;
+				}
+
+				putPadding(outputStringPtr, formatWidth);
+				putEscapedString(outputStringPtr);
+
+				currentCharacter = *format;
+				continue;
+			}
+
+			currentCharacter = *(++format);
+		}
+
+		if(0u == isNumber)
+		{
+			embedded_putChar('"');
+		}
+	}
+
+	putString((const uint8_t *)"}\r\n");
+
+	/* Cleanup the variable length argument list. */
+	va_end(arguments);
+
 	return;
 }
 
+#endif /* EMBPF_USE_KEY_VALUE */
+
+
+#if (1 == EMBPF_USE_RATE_LIMIT)
 
 /*FUNCTION**********************************************************************
  *
- * Function Name : putDigitInOutputBuffer
- * Description   : Puts a character into the output buffer string and increases
- * 				   the position pointer by 1
+ * Function Name : embedded_printf_rateLimitAllow
+ * Description   : Decides whether a rate limited call site may print.
+ *
+ * Comments:
+ * - The token bucket is implemented as a 'generic cell rate algorithm'. Instead
+ *   of a token count and a refill time it only keeps the time at which the
+ *   bucket is full again (theoreticalArrival). A single value can be updated
+ *   with one compare-and-exchange, so no lock is needed.
+ * - A message is allowed when theoreticalArrival is at most 'burst - 1' tokens
+ *   in the future. Every allowed message moves it one token further.
+ * - All tick arithmetic is done modulo 2^32 so the tick counter may wrap.
+ * - The ticks are read after theoreticalArrival is loaded, and again on every
+ *   retry. A concurrent update that is seen was therefore made at a tick that
+ *   is not newer than 'now', so it is at most 'burst' tokens ahead. Anything
+ *   further ahead can only be a leftover, see below.
  *
  *END**************************************************************************/
-static void putDigitInOutputBuffer(uint8_t outputDigit)
+uint8_t embedded_printf_rateLimitAllow(embpf_rateLimit_t * callSite,
+									   const uint8_t * format)
 {
-	ASSERT(15u >= outputDigit);
+	uint32_t sampleRate = embpf_RateLimitSampleRate;
+	uint32_t ticksPerToken = embpf_RateLimitTicksPerToken;
+	uint32_t burst = embpf_RateLimitBurst;
+	uint32_t tolerance;
+	uint32_t now;
+	uint32_t observedArrival;
+	uint32_t arrival;
+	uint32_t newArrival;
+	uint32_t registration = EMBPF_ATOMIC_LOAD(&callSite->isRegistered);
+	int32_t ticksAhead;
+	uint8_t isAllowed = 1u;
 
-	/* A digit between 0 and 9 can be turned into ASCII directly */
-	if(10u > outputDigit)
+	/*
+	 * Put the call site in the list the first time it is used. Only the call
+	 * that claims the registration initialises the site. It publishes the
+	 * result by making the site ready, so no other call can use (and update)
+	 * the token bucket before it has its initial value.
+	 */
+	if(RATE_LIMIT_UNREGISTERED == registration)
 	{
-		putInOutputBuffer(outputDigit + '0');
+		if(EMBPF_ATOMIC_COMPARE_EXCHANGE(&callSite->isRegistered,
+										 &registration, RATE_LIMIT_REGISTERING))
+		{
+			callSite->format = format;
+			callSite->theoreticalArrival = embedded_getTicks();
+			callSite->next = embpf_RateLimitCallSites;
+			while(!EMBPF_ATOMIC_COMPARE_EXCHANGE(&embpf_RateLimitCallSites,
+												 &callSite->next, callSite))
+			{
+				/* Another site registered first, callSite->next is updated */
+			}
+
+			registration = RATE_LIMIT_READY;
+			EMBPF_ATOMIC_EXCHANGE(&callSite->isRegistered, registration);
+		}
 	}
-	/* A digit between 10 and 15 is a hexadecimal letter. */
-	else
+
+	/* 1-in-N sampler: only every N-th call of this site gets through */
+	if(sampleRate > 1u)
 	{
-		if(embpf_InternalFlags & FLAG_HEX_USE_CAPITALS)
+		if(0u != (EMBPF_ATOMIC_FETCH_ADD(&callSite->callCount, 1u) % sampleRate))
 		{
-			putInOutputBuffer((outputDigit - 10u) + 'A');
+			isAllowed = 0u;
 		}
-		else
+	}
+
+	/* Token bucket, not used during the (short) registration of the site */
+	if((1u == isAllowed) && (0u != ticksPerToken) &&
+	   (RATE_LIMIT_READY == registration))
+	{
+		/* Cannot overflow, see embedded_printf_setRateLimit() */
+		tolerance = (burst - 1u) * ticksPerToken;
+		observedArrival = EMBPF_ATOMIC_LOAD(&callSite->theoreticalArrival);
+
+		do
 		{
-			putInOutputBuffer((outputDigit - 10u) + 'a');
-		}
+			/* Read the ticks only after the arrival time is loaded */
+			now = embedded_getTicks();
+			arrival = observedArrival;
+			ticksAhead = (int32_t)(arrival - now);
+
+			/*
+			 * An arrival time in the past means the bucket is full. One that
+			 * is further ahead than any update made up to now can put it is a
+			 * leftover from before the tick counter wrapped (or from older
+			 * settings). Both restart the bucket from now.
+			 */
+			if((ticksAhead < 0) ||
+			   ((uint32_t)ticksAhead > (tolerance + ticksPerToken)))
+			{
+				arrival = now;
+				ticksAhead = 0;
+			}
+
+			/* Bucket empty */
+			if((uint32_t)ticksAhead > tolerance)
+			{
+				isAllowed = 0u;
+				break;
+			}
+
+			newArrival = arrival + ticksPerToken;
+
+			/* Retry with the updated observedArrival if another call won */
+		} while(!EMBPF_ATOMIC_COMPARE_EXCHANGE(&callSite->theoreticalArrival,
+											   &observedArrival, newArrival));
 	}
 
-	embpf_InternalFlags |= FLAG_IS_NOT_FIRST_DIGIT;
+	if(0u == isAllowed)
+	{
+		EMBPF_ATOMIC_FETCH_ADD(&callSite->droppedCount, 1u);
+	}
 
-	return;
+	return isAllowed;
 }
 
 
 /*FUNCTION**********************************************************************
  *
- * Function Name : divideAndPutInOutputBuffer
- * Description   : Divides the u32integerNumber by the dividend and puts the
- * 				   number of divisions into the output buffer
+ * Function Name : embedded_printf_setRateLimit
+ * Description   : Sets the rate limit for all call sites.
+ *
+ * Comments:
+ * - burst * ticksPerToken must fit in 31 bits (RATE_LIMIT_MAX_TICKS_AHEAD).
+ *   Larger settings are clamped: first ticksPerToken, then the burst. This
+ *   keeps the limit instead of letting the tick arithmetic wrap.
  *
  *END**************************************************************************/
-static void divideAndPutInOutputBuffer(uint32_t * number, uint32_t dividend)
+void embedded_printf_setRateLimit(uint32_t sampleRate, uint32_t ticksPerToken,
+								  uint32_t burst)
 {
-	uint8_t outputDigit = 0u;
+	if(0u == burst)
+	{
+		burst = 1u;
+	}
 
-	/* Count how many times the division can be done */
-	while((*number) >= dividend)
+	if(ticksPerToken > RATE_LIMIT_MAX_TICKS_AHEAD)
 	{
-		(*number) -= dividend;
-		outputDigit++;
+		ticksPerToken = RATE_LIMIT_MAX_TICKS_AHEAD;
 	}
 
-	/* Print the count if >0, OR if it's a zero that follows a non-zero digit */
-	if((outputDigit > 0u) || (embpf_InternalFlags & FLAG_IS_NOT_FIRST_DIGIT))
+	if((0u != ticksPerToken) &&
+	   (burst > (RATE_LIMIT_MAX_TICKS_AHEAD / ticksPerToken)))
 	{
-		putDigitInOutputBuffer(outputDigit);
+		burst = RATE_LIMIT_MAX_TICKS_AHEAD / ticksPerToken;
 	}
 
+	embpf_RateLimitSampleRate = sampleRate;
+	embpf_RateLimitTicksPerToken = ticksPerToken;
+	embpf_RateLimitBurst = burst;
+
 	return;
 }
 
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : embedded_printf_rateLimitSummary
+ * Description   : Prints the number of dropped messages per format string.
+ *
+ * Comments:
+ * - The format string is passed to the output as it is, so its specifiers are
+ *   shown and not evaluated. Its trailing line ends are left out, to keep one
+ *   line per call site.
+ *
+ *END**************************************************************************/
+void embedded_printf_rateLimitSummary(void)
+{
+	embpf_rateLimit_t * callSite = embpf_RateLimitCallSites;
+	uint32_t droppedCount;
+	const uint8_t * formatEndPtr;
+	const uint8_t * formatPtr;
+
+	while(callSite)
+	{
+		droppedCount = EMBPF_ATOMIC_EXCHANGE(&callSite->droppedCount, 0u);
+
+		if(droppedCount > 0u)
+		{
+			/* Find the end of the format, without its trailing line ends */
+			formatEndPtr = callSite->format;
+			while(*formatEndPtr)
+			{
+				formatEndPtr++;
+			}
+			while((formatEndPtr != callSite->format) &&
+				  (('\r' == formatEndPtr[-1]) || ('\n' == formatEndPtr[-1])))
+			{
+				formatEndPtr--;
+			}
+
+			embedded_printf((const uint8_t *)"dropped %u: ", droppedCount);
+
+			for(formatPtr = callSite->format; formatPtr != formatEndPtr;
+				formatPtr++)
+			{
+				embedded_putChar(*formatPtr);
+			}
+
+			embedded_putChar('\r');
+			embedded_putChar('\n');
+		}
+
+		callSite = callSite->next;
+	}
+
+	return;
+}
+
+#endif /* EMBPF_USE_RATE_LIMIT */
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : parseFormatTag
+ * Description   : Evaluates the flags and width of a format tag
+ *
+ * Comments:
+ * - format points to the character following the '%'
+ * - The returned pointer points to the specifier
+ *
+ *END**************************************************************************/
+static const uint8_t * parseFormatTag(const uint8_t * format,
+									  uint8_t * formatWidth)
+{
+	/* Variable to temporarily contain the character that is evaluated */
+	uint8_t currentCharacter;
+
+	/* Clear all flags before formatting the current character */
+	embpf_InternalFlags = 0u;
+
+	/* Clear width variable too */
+	*formatWidth = 0u;
+
+	/* Get next character (i.e. the one following the '%') */
+	currentCharacter = *format;
+
+	/*
+	 *	Check if the current character is a '0'. if so, set a flag
+	 *	indicating zero padding must be done.
+	 *	Then get the next character.
+	 */
+	if('0' == currentCharacter)
+	{
+		embpf_InternalFlags |= FLAG_USE_ZERO_PADDING;
+		currentCharacter = *(++format);
+	}
+
+	/*
+	 * See if there is a character between '0' and '9'. If so, this
+	 * specifies the width.
+	 *
+	 * For every decimal number, the previous width must be *10.
+	 * Then add the newly found value. (Starting at width = 0u)
+	 * Repeat until no characters between '0' and '9' are found.
+	 */
+	while(('0' <= currentCharacter) && ('9' >= currentCharacter))
+	{
+		/*
+		 * Shifting is faster and smaller than multiplication so:
+		 * formatWidth*10 is done as follows:
+		 * 1) Shift left by 2. This is the same as *4
+		 * 2) Add its original self. To the result: Now we have *5
+		 * 3) Shift left by 1. This is the same as *2. Now the total
+		 * 	  is *10
+		 */
+		*formatWidth = (((*formatWidth << 2u) + *formatWidth) << 1u);
+
+		/* Add integer value of current decimal character */
+		*formatWidth += (currentCharacter - '0');
+
+		currentCharacter = *(++format);
+	}
+
+	return format;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : formatArgument
+ * Description   : Takes the next argument from the list and formats it
+ * 				   according to the specifier
+ *
+ * Comments:
+ * - Returns a pointer to the '\0' terminated formatted string. This is either
+ *   the outputBuffer or, for %s, the string argument itself.
+ *
+ *END**************************************************************************/
+static uint8_t * formatArgument(uint8_t specifier, va_list * arguments)
+{
+	/* Pointer to the start of the string that is to be passed to the output */
+	uint8_t * outputStringPtr;
+
+	/* temporary value to pass a number for formatting */
+	uint32_t u32integerNumber;
+
+	outputBufferPtr = outputBuffer;
+	outputStringPtr	= outputBuffer;
+
+	/* Now determine the specifier and act accordingly */
+	switch(specifier)
+	{
+		case 'u':
+		case 'i':
+		case 'd':
+			u32integerNumber = va_arg(*arguments, uint32_t);
+
+#if (1 == EMBPF_USE_SIGNED)
+			/* Check if integer is actually signed */
+			if(('d' == specifier) || ('i' == specifier))
+			{
+				/*
+				 * Check if the signed integer < 0
+				 * If so take 2's complement and put a '-' sign to the
+				 * outputBuffer
+				 */
+				if((int32_t)u32integerNumber < 0)
+				{
+					u32integerNumber = ((~u32integerNumber) + 1u);
+					putInOutputBuffer('-');
+				}
+			}
+#endif
+
+#if (EMBPF_DIGIT_ENGINE_TABLE == EMBPF_DIGIT_ENGINE)
+			outputStringPtr = formatDecimal(u32integerNumber);
+#else
+			putDecimalInOutputBuffer(u32integerNumber);
+#endif
+
+			break;
+
+		case 'x':
+		case 'X':
+			if('X' == specifier)
+			{
+				embpf_InternalFlags |= FLAG_HEX_USE_CAPITALS;
+			}
+
+			u32integerNumber = va_arg(*arguments, uint32_t);
+
+#if (EMBPF_DIGIT_ENGINE_TABLE == EMBPF_DIGIT_ENGINE)
+			outputStringPtr = formatHexadecimal(u32integerNumber);
+#else
+			putHexadecimalInOutputBuffer(u32integerNumber);
+#endif
+			break;
+
+#if (1 == EMBPF_USE_CHARACTER)
+		case 'c':
+			/*
+			 * Get the character from the arguments list and put it into
+			 * the buffer
+			 */
+			putInOutputBuffer((uint8_t)(va_arg(*arguments, uint32_t)));
+			break;
+#else
+		case 'c':
+			/*
+			 * Switched off: print nothing, but still take the argument so
+			 * the arguments after it stay in place
+			 */
+			(void)va_arg(*arguments, uint32_t);
+			break;
+#endif
+
+#if (1 == EMBPF_USE_STRING)
+		case 's':
+			/*
+			 * The variable is already a string, so set the
+			 * outputStringPtr to this string instead
+			 */
+			outputStringPtr = (uint8_t *)(va_arg(*arguments, uint8_t *));
+			break;
+#else
+		case 's':
+			/* Switched off: print nothing, but still take the argument */
+			(void)va_arg(*arguments, uint8_t *);
+			break;
+#endif
+
+		case '%':
+			putInOutputBuffer('%');
+			break;
+
+		default:
+			break;
+	} /* switch(specifier) */
+
+	/* Add string terminator to buffer */
+	*outputBufferPtr = '\0';
+
+	return outputStringPtr;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putPadding
+ * Description   : Puts the zeros or spaces needed to fill up the width to the
+ * 				   output function
+ *
+ *END**************************************************************************/
+static void putPadding(const uint8_t * string, uint8_t formatWidth)
+{
+	/* Subtract the string length from the formatWidth */
+	while((*(string++)) && (formatWidth > 0u))
+	{
+		formatWidth--;
+	}
+
+	/*
+	 * If the width > string: put the required zeros or spaces to the
+	 * output function
+	 */
+	while(formatWidth-- > 0u)
+	{
+		if(embpf_InternalFlags & FLAG_USE_ZERO_PADDING)
+		{
+			embedded_putChar('0');
+		}
+		else
+		{
+			embedded_putChar(' ');
+		}
+	}
+
+	return;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putString
+ * Description   : Passes a string to the output function, one character at a
+ * 				   time
+ *
+ *END**************************************************************************/
+static void putString(const uint8_t * string)
+{
+	uint8_t currentCharacter = *(string++);
+
+	while(currentCharacter)
+	{
+		embedded_putChar(currentCharacter);
+		currentCharacter = *(string++);
+	}
+
+	return;
+}
+
+
+#if (1 == EMBPF_USE_KEY_VALUE)
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putEscapedCharacter
+ * Description   : Passes a character to the output function, escaped as
+ * 				   needed inside a JSON string
+ *
+ * Comments:
+ * - JSON requires escaping of '"', '\' and all control characters (< 0x20).
+ *   The common control characters have a short escape, the others are
+ *   printed as \u00XX.
+ *
+ *END**************************************************************************/
+static void putEscapedCharacter(uint8_t character)
+{
+	/* Variable to hold the lower hexadecimal digit of a \u00XX escape */
+	uint8_t hexDigit;
+
+	switch(character)
+	{
+		case '"':
+		case '\\':
+			embedded_putChar('\\');
+			embedded_putChar(character);
+			break;
+
+		case '\n':
+			embedded_putChar('\\');
+			embedded_putChar('n');
+			break;
+
+		case '\r':
+			embedded_putChar('\\');
+			embedded_putChar('r');
+			break;
+
+		case '\t':
+			embedded_putChar('\\');
+			embedded_putChar('t');
+			break;
+
+		default:
+			if(0x20u > character)
+			{
+				putString((const uint8_t *)"\\u00");
+
+				/* The upper digit of a control character is 0 or 1 */
+				embedded_putChar('0' + (character >> 4u));
+
+				hexDigit = (character & 0x0Fu);
+				if(10u > hexDigit)
+				{
+					embedded_putChar(hexDigit + '0');
+				}
+				else
+				{
+					embedded_putChar((hexDigit - 10u) + 'a');
+				}
+			}
+			else
+			{
+				embedded_putChar(character);
+			}
+			break;
+	} /* switch(character) */
+
+	return;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putEscapedString
+ * Description   : Passes a string to the output function, escaped as needed
+ * 				   inside a JSON string
+ *
+ * Comments:
+ * - Most strings contain nothing that needs escaping. So whenever the string
+ *   pointer is aligned to 4 bytes, the next 4 characters are checked at once.
+ *   When none of them is a '"', '\' or a control character (which includes
+ *   the '\0' terminator), they are passed to the output without checking
+ *   each of them. Otherwise the characters are handled one by one until the
+ *   pointer is aligned again.
+ * - An aligned word never crosses a memory (protection) boundary, so reading
+ *   a few characters beyond the '\0' terminator is harmless. AddressSanitizer
+ *   doesn't know that, so it is switched off for this function. For valgrind
+ *   set EMBPF_USE_WORD_READS to 0 to check the characters one by one.
+ *
+ *END**************************************************************************/
+EMBPF_NO_SANITIZE_ADDRESS
+static void putEscapedString(const uint8_t * string)
+{
+	/* Variable to temporarily contain the character that is evaluated */
+	uint8_t currentCharacter = *string;
+
+#if (1 == EMBPF_USE_WORD_READS)
+	/* Variable to contain the 4 characters that are evaluated at once */
+	uint32_t word;
+#endif
+
+	while(currentCharacter)
+	{
+#if (1 == EMBPF_USE_WORD_READS)
+		if(0u == ((uintptr_t)string & 0x3u))
+		{
+			word = *((const embpf_word_t *)string);
+
+			if(0u == (WORD_HAS_CHARACTER_BELOW(word, 0x20u) |
+					  WORD_HAS_CHARACTER(word, '"') |
+					  WORD_HAS_CHARACTER(word, '\\')))
+			{
+				embedded_putChar(string[0]);
+				embedded_putChar(string[1]);
+				embedded_putChar(string[2]);
+				embedded_putChar(string[3]);
+
+				string += 4;
+				currentCharacter = *string;
+				continue;
+			}
+		}
+#endif
+
+		putEscapedCharacter(currentCharacter);
+		currentCharacter = *(++string);
+	}
+
+	return;
+}
+
+#endif /* EMBPF_USE_KEY_VALUE */
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putInOutputBuffer
+ * Description   : Puts a character into the output buffer string and increases
+ * 				   the position pointer by 1
+ *
+ *END**************************************************************************/
+static void putInOutputBuffer(uint8_t character)
+{
+	*(outputBufferPtr++) = character;
+	return;
+}
+
+
+#if (1 == EMBPF_USE_TINY_ENGINE)
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putDigitInOutputBuffer
+ * Description   : Puts a character into the output buffer string and increases
+ * 				   the position pointer by 1
+ *
+ *END**************************************************************************/
+static void putDigitInOutputBuffer(uint8_t outputDigit)
+{
+	ASSERT(15u >= outputDigit);
+
+	/* A digit between 0 and 9 can be turned into ASCII directly */
+	if(10u > outputDigit)
+	{
+		putInOutputBuffer(outputDigit + '0');
+	}
+	/* A digit between 10 and 15 is a hexadecimal letter. */
+	else
+	{
+		if(embpf_InternalFlags & FLAG_HEX_USE_CAPITALS)
+		{
+			putInOutputBuffer((outputDigit - 10u) + 'A');
+		}
+		else
+		{
+			putInOutputBuffer((outputDigit - 10u) + 'a');
+		}
+	}
+
+	embpf_InternalFlags |= FLAG_IS_NOT_FIRST_DIGIT;
+
+	return;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : divideAndPutInOutputBuffer
+ * Description   : Divides the u32integerNumber by the dividend and puts the
+ * 				   number of divisions into the output buffer
+ *
+ *END**************************************************************************/
+static void divideAndPutInOutputBuffer(uint32_t * number, uint32_t dividend)
+{
+	uint8_t outputDigit = 0u;
+
+	/* Count how many times the division can be done */
+	while((*number) >= dividend)
+	{
+		(*number) -= dividend;
+		outputDigit++;
+	}
+
+	/* Print the count if >0, OR if it's a zero that follows a non-zero digit */
+	if((outputDigit > 0u) || (embpf_InternalFlags & FLAG_IS_NOT_FIRST_DIGIT))
+	{
+		putDigitInOutputBuffer(outputDigit);
+	}
+
+	return;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putDecimalInOutputBuffer
+ * Description   : Puts the decimal digits of a number into the output buffer
+ *
+ *END**************************************************************************/
+static void putDecimalInOutputBuffer(uint32_t number)
+{
+	/*
+	 * Now to determine all digits that are in the integer.
+	 * Say we have a number of 654321. Somehow we need to get
+	 * the 6 first, then the 5, then the 4 etc..
+	 *
+	 * Now let's subtract 100000 from the number and count how
+	 * many times we can do that until the remainder is smaller
+	 * than 100000.
+	 *
+	 * We end up with a count of 6 and a remainder of 54321
+	 * The count is our first digit and can be put into the
+	 * output buffer.
+	 *
+	 * Now repeat this with a dividend of 10000. We end up with
+	 * a count of 5 and a remainder of 4321.
+	 *
+	 * See where we're going?
+	 *
+	 * We can stop dividing after we did the 10s. As only the
+	 * 1s are left and they can be put directly into the output
+	 * buffer.
+	 *
+	 * Now for a 32bits integer we need to start dividing by
+	 * 1.000.000.000
+	 *
+	 */
+#if (1 == EMBPF_TINY_ENGINE_UNROLLED)
+	divideAndPutInOutputBuffer(&number, 1000000000u);
+	divideAndPutInOutputBuffer(&number,  100000000u);
+	divideAndPutInOutputBuffer(&number,   10000000u);
+	divideAndPutInOutputBuffer(&number,    1000000u);
+	divideAndPutInOutputBuffer(&number,     100000u);
+	divideAndPutInOutputBuffer(&number,      10000u);
+	divideAndPutInOutputBuffer(&number,       1000u);
+	divideAndPutInOutputBuffer(&number,        100u);
+	divideAndPutInOutputBuffer(&number,         10u);
+	putDigitInOutputBuffer(number);
+#else
+	putDigitsInOutputBuffer(number, decimalDivisors);
+#endif
+
+	return;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putHexadecimalInOutputBuffer
+ * Description   : Puts the hexadecimal digits of a number into the output
+ * 				   buffer
+ *
+ *END**************************************************************************/
+static void putHexadecimalInOutputBuffer(uint32_t number)
+{
+	/*
+	 * The principle of getting the digits out is the same as
+	 * with the decimal integers (see putDecimalInOutputBuffer). Now
+	 * however we need to divide by powers of 16.
+	 *
+	 * For a 32bits hexadecimal value we start to divide with
+	 * 0x10000000
+	 */
+#if (1 == EMBPF_TINY_ENGINE_UNROLLED)
+	divideAndPutInOutputBuffer(&number, 0x10000000);
+	divideAndPutInOutputBuffer(&number, 0x1000000);
+	divideAndPutInOutputBuffer(&number, 0x100000);
+	divideAndPutInOutputBuffer(&number, 0x10000);
+	divideAndPutInOutputBuffer(&number, 0x1000);
+	divideAndPutInOutputBuffer(&number, 0x100);
+	divideAndPutInOutputBuffer(&number, 0x10);
+	putDigitInOutputBuffer(number);
+#else
+	putDigitsInOutputBuffer(number, hexadecimalDivisors);
+#endif
+
+	return;
+}
+
+
+#if (0 == EMBPF_TINY_ENGINE_UNROLLED)
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : putDigitsInOutputBuffer
+ * Description   : Puts the digits of a number into the output buffer by
+ * 				   dividing it by each of the divisors in turn
+ *
+ * Comments:
+ * - The same as the unrolled calls in putDecimalInOutputBuffer and
+ *   putHexadecimalInOutputBuffer, but with one call in a loop. This saves the
+ *   code of the unrolled calls at the cost of the 2 tables (72 bytes) and a
+ *   load per divisor.
+ * - The 1 at the end of the table stops the loop. What is left is the last
+ *   digit, which is always printed (also when the number is 0).
+ *
+ *END**************************************************************************/
+static void putDigitsInOutputBuffer(uint32_t number, const uint32_t * divisors)
+{
+	while(1u != *divisors)
+	{
+		divideAndPutInOutputBuffer(&number, *(divisors++));
+	}
+	putDigitInOutputBuffer(number);
+
+	return;
+}
+
+#endif /* EMBPF_TINY_ENGINE_UNROLLED */
+
+#endif /* EMBPF_USE_TINY_ENGINE */
+
+
+#if (EMBPF_DIGIT_ENGINE_TABLE == EMBPF_DIGIT_ENGINE)
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : formatDecimal
+ * Description   : Puts the decimal digits of a number at the end of the output
+ * 				   buffer
+ *
+ * Comments:
+ * - Dividing by 100 gives the last 2 digits as remainder. These are looked up
+ *   in the decimalDigitPairs table at once. So a 10 digit number takes 5
+ *   divisions instead of the up to 90 subtractions of the tiny engine.
+ * - The digits are found last to first, so the buffer is filled from the end
+ *   towards the start.
+ * - A negative number already put its '-' at the start of the buffer. It is
+ *   moved in front of the digits.
+ * - outputBufferPtr is set to the '\0' at the end, so formatArgument() can
+ *   still terminate the buffer as usual.
+ *
+ *END**************************************************************************/
+static uint8_t * formatDecimal(uint32_t number)
+{
+	/* The digits are put into the buffer from the end, just before the '\0' */
+	uint8_t * digitPtr = &outputBuffer[sizeof(outputBuffer) - 1u];
+
+	/* Position of the current pair of digits in decimalDigitPairs */
+	uint32_t pairIndex;
+
+	/* The part of the number that still needs to be converted */
+	uint32_t remainingNumber = number;
+
+	/* A '-' sign in the buffer means the number is negative */
+	uint8_t isNegative = (outputBufferPtr != outputBuffer);
+
+	*digitPtr = '\0';
+
+	while(remainingNumber >= 100u)
+	{
+		pairIndex = ((remainingNumber % 100u) << 1u);
+		remainingNumber /= 100u;
+
+		*(--digitPtr) = decimalDigitPairs[pairIndex + 1u];
+		*(--digitPtr) = decimalDigitPairs[pairIndex];
+	}
+
+	/* 1 or 2 digits left */
+	if(remainingNumber >= 10u)
+	{
+		pairIndex = (remainingNumber << 1u);
+
+		*(--digitPtr) = decimalDigitPairs[pairIndex + 1u];
+		*(--digitPtr) = decimalDigitPairs[pairIndex];
+	}
+	else
+	{
+		*(--digitPtr) = (remainingNumber + '0');
+	}
+
+	/* Move the '-' sign in front of the digits */
+	if(isNegative)
+	{
+		*(--digitPtr) = '-';
+	}
+
+#if (1 == EMBPF_VERIFY_DIGIT_ENGINE)
+	verifyDigitEngine(digitPtr, number, isNegative, 0u);
+#endif
+
+	outputBufferPtr = &outputBuffer[sizeof(outputBuffer) - 1u];
+
+	return digitPtr;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : formatHexadecimal
+ * Description   : Puts the hexadecimal digits of a number at the end of the
+ * 				   output buffer
+ *
+ * Comments:
+ * - Every 4 bits are 1 hexadecimal digit, so no division is needed. The
+ *   lowest 4 bits are looked up, then the number is shifted right by 4 until
+ *   no bits are left.
+ *
+ *END**************************************************************************/
+static uint8_t * formatHexadecimal(uint32_t number)
+{
+	/* The digits are put into the buffer from the end, just before the '\0' */
+	uint8_t * digitPtr = &outputBuffer[sizeof(outputBuffer) - 1u];
+
+	/* Table with the digits to use, small letters or capitals */
+	const uint8_t * hexDigits = hexDigitsSmall;
+
+	/* The part of the number that still needs to be converted */
+	uint32_t remainingNumber = number;
+
+	if(embpf_InternalFlags & FLAG_HEX_USE_CAPITALS)
+	{
+		hexDigits = hexDigitsCapital;
+	}
+
+	*digitPtr = '\0';
+
+	/* Always at least 1 digit, also for 0 */
+	do
+	{
+		*(--digitPtr) = hexDigits[remainingNumber & 0xFu];
+		remainingNumber >>= 4u;
+	} while(remainingNumber);
+
+#if (1 == EMBPF_VERIFY_DIGIT_ENGINE)
+	verifyDigitEngine(digitPtr, number, 0u, 1u);
+#endif
+
+	outputBufferPtr = &outputBuffer[sizeof(outputBuffer) - 1u];
+
+	return digitPtr;
+}
+
+#endif /* EMBPF_DIGIT_ENGINE_TABLE */
+
+
+#if (1 == EMBPF_VERIFY_DIGIT_ENGINE)
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : verifyDigitEngine
+ * Description   : Formats a number with the tiny engine and ASSERTs that the
+ * 				   result equals that of the table engine
+ *
+ * Comments:
+ * - The tiny engine is the reference: it's the original embedded printf code.
+ *   Any difference is a bug in the table engine.
+ * - The tiny engine writes through outputBufferPtr, so that is pointed to
+ *   verifyBuffer temporarily.
+ *
+ *END**************************************************************************/
+static void verifyDigitEngine(const uint8_t * formatted, uint32_t number,
+							  uint8_t isNegative, uint8_t isHexadecimal)
+{
+	/* Pointer to step through the reference result */
+	const uint8_t * referencePtr = verifyBuffer;
+
+	/* The tiny engine leaves a flag behind, keep the caller's flags */
+	uint8_t savedFlags = embpf_InternalFlags;
+
+	outputBufferPtr = verifyBuffer;
+	embpf_InternalFlags &= ~FLAG_IS_NOT_FIRST_DIGIT;
+
+	if(isNegative)
+	{
+		putInOutputBuffer('-');
+	}
+
+	if(isHexadecimal)
+	{
+		putHexadecimalInOutputBuffer(number);
+	}
+	else
+	{
+		putDecimalInOutputBuffer(number);
+	}
+
+	*outputBufferPtr = '\0';
+	embpf_InternalFlags = savedFlags;
+
+	/* Both strings must be equal, including their length */
+	while(*referencePtr)
+	{
+		ASSERT(*referencePtr == *formatted);
+		referencePtr++;
+		formatted++;
+	}
+	ASSERT('\0' == *formatted);
+
+	return;
+}
+
+#endif /* EMBPF_VERIFY_DIGIT_ENGINE */
+
+
 /*******************************************************************************
  * EOF
  ******************************************************************************/
@@ -130,10 +130,12 @@
  * 	    putChar (or similar) function. E.g. something that puts the character on
  * 	    a UART/Serial output
  * 3: Optional: define a macro to map the standard printf to embedded_printf
+ * 4: Optional: select the features in embedded_printf_config.h
  *
  */
 #include <stdarg.h> 	/*<! required for the va_list library functions */
 #include <stdint.h>		/*<! definition for platform independent types */
+#include "embedded_printf_config.h"	/*<! feature selection */
 //#include "assert.h"	/*<! provide your own macro for ASSERT here */
 
 
@@ -157,6 +159,8 @@
  */
 //#define embedded_printf(x)		ebd_printf(x)
 
+/*!< Macro to map the tick source used by the rate limiter (free running) */
+#define embedded_getTicks()						SYSTICK_GetTicks()
 
 
 
@@ -210,11 +214,141 @@ extern "C" {
  * @Note
  * 1. All integers are interpreted as 32 bits
  * 2. Characters (char) are unsigned 8 bits
- * 3. All hexadecimal output is preceded with 0x;
+ * 3. Hexadecimal output has no 0x prefix, put it in the format if needed
  */
 void embedded_printf(const uint8_t *format, ...);
 
 
+#if (1 == EMBPF_USE_KEY_VALUE)
+
+/*!
+ * @brief Prints key=value pairs as a JSON object to the specified output
+ *
+ * @param [in]  event	name of the event, printed as the first field
+ * @param [in]  format	space separated key=value pairs, the values may contain
+ * 						format tags
+ * @param [in]  ...		list of all the variables that need formatting into the
+ * 						values
+ * @param [out] none
+ *
+ * @Description
+ *
+ * Example:
+ *
+ * embedded_printf_kv("rx", "id=%u dev=%s code=%x", 12u, "uart1", 0x1Fu);
+ *
+ * prints:
+ *
+ * {"event":"rx","id":12,"dev":"uart1","code":"1f"}\r\n
+ *
+ * The format tags are the same as for embedded_printf(). A value that is only
+ * a %d, %i or %u without width is printed as a JSON number. Every other value
+ * is printed as a JSON string. Quotes, backslashes and control characters in
+ * the strings are escaped while printing, so no intermediate buffer is used.
+ *
+ * @Note
+ * 1. Keys are printed as they are and are not escaped
+ * 2. Characters 0x80 and up are passed unchanged, i.e. strings must be UTF-8
+ */
+void embedded_printf_kv(const uint8_t *event, const uint8_t *format, ...);
+
+#endif /* EMBPF_USE_KEY_VALUE */
+
+
+#if (1 == EMBPF_USE_RATE_LIMIT)
+
+/*!
+ * State of a single rate limited call site. One of these is created (static,
+ * zero initialised) by every embedded_printf_limited() in the code. Do not
+ * access the members directly.
+ */
+typedef struct embpf_rateLimit
+{
+	const uint8_t * format;				/*!< format string of the call site */
+	uint32_t isRegistered;				/*!< registration state of the site */
+	uint32_t callCount;					/*!< calls seen, used for 1-in-N */
+	uint32_t droppedCount;				/*!< calls dropped since last summary */
+	uint32_t theoreticalArrival;		/*!< token bucket state in ticks */
+	struct embpf_rateLimit * next;		/*!< next registered call site */
+} embpf_rateLimit_t;
+
+/*!
+ * @brief Decides whether a rate limited call site may print
+ *
+ * @param [in]  callSite	state of the calling site
+ * @param [in]  format		format string of the calling site
+ * @param [out] 1 when the message must be printed, 0 when it is dropped
+ *
+ * @Description
+ *
+ * A message passes when both the 1-in-N sampler and the token bucket allow it.
+ * The sampler lets every N-th call of a site through. The token bucket allows
+ * a burst of messages after which one message per ticksPerToken ticks is let
+ * through. The state is updated using atomic operations only, so the function
+ * may be called from interrupts and other threads without a lock.
+ *
+ * Normally called through embedded_printf_limited() only.
+ */
+uint8_t embedded_printf_rateLimitAllow(embpf_rateLimit_t * callSite,
+									   const uint8_t * format);
+
+/*!
+ * @brief Sets the rate limit for all call sites at runtime
+ *
+ * @param [in]  sampleRate		print 1 in sampleRate calls (0 and 1: all)
+ * @param [in]  ticksPerToken	ticks needed to earn one message (0: no limit)
+ * @param [in]  burst			messages that can be printed back to back
+ * @param [out] none
+ *
+ * @Description
+ *
+ * burst * ticksPerToken must fit in 31 bits. Larger values are clamped,
+ * ticksPerToken first and then burst.
+ */
+void embedded_printf_setRateLimit(uint32_t sampleRate, uint32_t ticksPerToken,
+								  uint32_t burst);
+
+/*!
+ * @brief Prints the number of dropped messages per format string
+ *
+ * @param [in]  none
+ * @param [out] none
+ *
+ * @Description
+ *
+ * Only call sites that dropped messages since the previous summary are
+ * reported. The dropped counters are cleared afterwards. Call it
+ * periodically, e.g. from a low priority task.
+ */
+void embedded_printf_rateLimitSummary(void);
+
+/*!< Helper macro to get the format string out of the variable arguments */
+#define EMBPF_FIRST_ARGUMENT(first, ...)		(first)
+
+/*!
+ * Rate limited embedded_printf(). Takes the same arguments. Dropped messages
+ * return before the arguments are evaluated or the format is parsed.
+ */
+#define embedded_printf_limited(...)											\
+	do																			\
+	{																			\
+		static embpf_rateLimit_t embpf_callSite;								\
+		if(embedded_printf_rateLimitAllow(&embpf_callSite,						\
+						(const uint8_t *)EMBPF_FIRST_ARGUMENT(__VA_ARGS__, 0)))	\
+		{																		\
+			embedded_printf(__VA_ARGS__);										\
+		}																		\
+	} while(0)
+
+#else
+
+#define embedded_printf_limited(...)			embedded_printf(__VA_ARGS__)
+#define embedded_printf_setRateLimit(sampleRate, ticksPerToken, burst)
+#define embedded_printf_rateLimitSummary()
+
+#endif /* EMBPF_USE_RATE_LIMIT */
+
+
 #if defined(__cplusplus)
 }
 #endif
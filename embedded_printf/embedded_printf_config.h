@@ -0,0 +1,238 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embedded_printf_config.h
+ *		Author	  	: Christean van der Mijden
+ *		Date		: 18 October 2026
+ *		Version		: 1.00
+ *
+ *		Project		: N/A
+ *		Processor	: N/A
+ *		Component	: configuration of embedded printf
+ *		Compiler	: GCC ARM
+ *
+ *	Revision History:
+ *	------------------------------------------------------------------------
+ *	18 October 2026			version 1
+ *
+ *
+ *
+ *	@license
+ *
+ *	This library is free software; you can redistribute it and/or modify it
+ *	under the terms of the GNU Lesser General Public License as published by the
+ *	Free Software Foundation; either version 3.0 of the License, or (at your
+ *	option) any later version.
+ *
+ *	The GNU Lesser General Public License v3.0 can be found here:
+ *
+ *			http://www.gnu.org/licenses/lgpl-3.0.en.html
+ *
+ *
+ *	In addition the following applies:
+ *
+ * 	Redistribution and use in source and binary forms, with or without
+ * 	modification, are permitted provided that the following conditions
+ * 	are met:
+ *
+ * 	o Redistributions of source code must retain the above copyright
+ * 	  notice, this list of conditions and the following disclaimer.
+ *
+ * 	o Redistributions in binary form must reproduce the above copyright
+ * 	  notice, this list of conditions and the following disclaimer in the
+ * 	  documentation and/or other materials provided with the distribution.
+ *
+ * 	o Neither the name of Christean van der Mijden, Heart of Technology, nor the
+ * 	  names of their contributors may be used to endorse or promote products
+ * 	  derived from this software without specific prior written permission.
+ *
+ * 	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * 	"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * 	LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * 	A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * 	HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * 	SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * 	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * 	DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * 	THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * 	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * 	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ */
+#ifndef __EMBEDDED_PRINTF_CONFIG_H_
+#define __EMBEDDED_PRINTF_CONFIG_H_
+
+
+/*! @file
+ *
+ * Compile time configuration of embedded printf.
+ *
+ * A bootloader needs the smallest possible printf, the application is better
+ * off with a fast one. Select one of the tiers below with EMBPF_TIER, e.g.
+ * -DEMBPF_TIER=EMBPF_TIER_MINIMAL on the command line. The tier sets the
+ * defaults for all options below. Each option can still be overruled on its
+ * own by defining it before this header is included (or on the command line).
+ *
+ * Everything that is switched off is left out by the preprocessor, so it
+ * takes no flash and costs no time.
+ *
+ */
+
+
+/*******************************************************************************
+ * Tiers
+ ******************************************************************************/
+
+/*!< Smallest size: all specifiers, tiny digit engine as a loop */
+#define EMBPF_TIER_MINIMAL						(1)
+
+/*!< All specifiers, tiny digit engine. The original embedded printf */
+#define EMBPF_TIER_DEFAULT						(2)
+
+/*!< All specifiers, table driven digit engine */
+#define EMBPF_TIER_FAST							(3)
+
+#ifndef EMBPF_TIER
+	#define EMBPF_TIER							EMBPF_TIER_DEFAULT
+#endif
+
+
+/*******************************************************************************
+ * Digit engines
+ ******************************************************************************/
+
+/*!
+ * Tiny: finds every digit by repeated subtraction of powers of 10 (or 16).
+ * No tables and no division, the smallest code.
+ */
+#define EMBPF_DIGIT_ENGINE_TINY					(1)
+
+/*!
+ * Table: converts 2 decimal digits per division by 100 using a 200 byte table
+ * and 1 hexadecimal digit per shift. Faster on cores with a hardware divider
+ * (Cortex-M3 and up), at the cost of the tables.
+ */
+#define EMBPF_DIGIT_ENGINE_TABLE				(2)
+
+#ifndef EMBPF_DIGIT_ENGINE
+	#if (EMBPF_TIER_FAST == EMBPF_TIER)
+		#define EMBPF_DIGIT_ENGINE				EMBPF_DIGIT_ENGINE_TABLE
+	#else
+		#define EMBPF_DIGIT_ENGINE				EMBPF_DIGIT_ENGINE_TINY
+	#endif
+#endif
+
+/*!
+ * Tiny engine only. 1 makes one call per power of 10 (or 16), as the original
+ * embedded printf does. 0 loops over a table of the powers instead: about 100
+ * bytes smaller, but some 20% slower.
+ */
+#ifndef EMBPF_TINY_ENGINE_UNROLLED
+	#if (EMBPF_TIER_MINIMAL == EMBPF_TIER)
+		#define EMBPF_TINY_ENGINE_UNROLLED		(0)
+	#else
+		#define EMBPF_TINY_ENGINE_UNROLLED		(1)
+	#endif
+#endif
+
+/*!
+ * Set to 1 to check every number the table engine formats against the tiny
+ * engine (the reference) with ASSERT. For test builds only: it costs the
+ * size and time of both engines.
+ */
+#ifndef EMBPF_VERIFY_DIGIT_ENGINE
+	#define EMBPF_VERIFY_DIGIT_ENGINE			(0)
+#endif
+
+#if (1 == EMBPF_VERIFY_DIGIT_ENGINE) &&									\
+	(EMBPF_DIGIT_ENGINE_TABLE != EMBPF_DIGIT_ENGINE)
+	#error "EMBPF_VERIFY_DIGIT_ENGINE requires EMBPF_DIGIT_ENGINE_TABLE"
+#endif
+
+
+/*******************************************************************************
+ * Specifiers
+ ******************************************************************************/
+
+/*
+ * %u, %x and %X are always available. A specifier that is switched off still
+ * takes its argument from the list, so the arguments after it keep their
+ * place. Without EMBPF_USE_SIGNED, %d and %i print the argument as %u does;
+ * a switched off %c or %s prints nothing.
+ */
+
+/*!< %d and %i: signed decimal integers (otherwise printed as unsigned) */
+#ifndef EMBPF_USE_SIGNED
+	#define EMBPF_USE_SIGNED					(1)
+#endif
+
+/*!< %c: single character */
+#ifndef EMBPF_USE_CHARACTER
+	#define EMBPF_USE_CHARACTER					(1)
+#endif
+
+/*!< %s: string of characters */
+#ifndef EMBPF_USE_STRING
+	#define EMBPF_USE_STRING					(1)
+#endif
+
+
+/*******************************************************************************
+ * Extensions
+ ******************************************************************************/
+
+/*!
+ * Per call site rate limiting. Set to 1 to let embedded_printf_limited() drop
+ * messages before any formatting is done. With 0 (default) the macro maps
+ * directly onto embedded_printf().
+ */
+#ifndef EMBPF_USE_RATE_LIMIT
+	#define EMBPF_USE_RATE_LIMIT				(0)
+#endif
+
+/*!
+ * Structured output. Set to 1 to add embedded_printf_kv() which prints
+ * key=value pairs as a single JSON object. 0 (default) leaves it out.
+ */
+#ifndef EMBPF_USE_KEY_VALUE
+	#define EMBPF_USE_KEY_VALUE					(0)
+#endif
+
+
+/*******************************************************************************
+ * Memory access
+ ******************************************************************************/
+
+/*!
+ * Strings are read a word at a time where possible: 4 characters by
+ * embedded_printf_kv() and 8 by embedded_sscanf(). The reads are aligned, so
+ * they may read up to 3 (or 7) characters beyond the '\0' terminator within
+ * the same aligned word, which is harmless on the target. Set to 0 to read one
+ * character at a time, e.g. for host builds under valgrind.
+ */
+#ifndef EMBPF_USE_WORD_READS
+	#define EMBPF_USE_WORD_READS				(1)
+#endif
+
+/*
+ * AddressSanitizer doesn't know about the aligned words and would report the
+ * characters beyond the '\0' as an overflow. Functions doing word reads are
+ * marked with this to tell it not to check them.
+ */
+#if defined(__has_attribute)
+	#if __has_attribute(no_sanitize_address)
+		#define EMBPF_NO_SANITIZE_ADDRESS	__attribute__((no_sanitize_address))
+	#endif
+#endif
+#ifndef EMBPF_NO_SANITIZE_ADDRESS
+	#define EMBPF_NO_SANITIZE_ADDRESS
+#endif
+
+
+#endif /* __EMBEDDED_PRINTF_CONFIG_H_ */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,720 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embedded_scanf.c
+ *		Author	  	: Christean van der Mijden
+ *		Date		: 18 October 2026
+ *		Version		: 1.00
+ *
+ *		Project		: N/A
+ *		Processor	: N/A
+ *		Component	: stripped down sscanf for embedded applications
+ *		Compiler	: GCC ARM
+ *
+ *	Revision History:
+ *	------------------------------------------------------------------------
+ *	18 October 2026			version 1
+ *
+ *
+ *
+ *	@license
+ *
+ *	This library is free software; you can redistribute it and/or modify it
+ *	under the terms of the GNU Lesser General Public License as published by the
+ *	Free Software Foundation; either version 3.0 of the License, or (at your
+ *	option) any later version.
+ *
+ *	The GNU Lesser General Public License v3.0 can be found here:
+ *
+ *			http://www.gnu.org/licenses/lgpl-3.0.en.html
+ *
+ *
+ *	In addition the following applies:
+ *
+ * 	Redistribution and use in source and binary forms, with or without
+ * 	modification, are permitted provided that the following conditions
+ * 	are met:
+ *
+ * 	o Redistributions of source code must retain the above copyright
+ * 	  notice, this list of conditions and the following disclaimer.
+ *
+ * 	o Redistributions in binary form must reproduce the above copyright
+ * 	  notice, this list of conditions and the following disclaimer in the
+ * 	  documentation and/or other materials provided with the distribution.
+ *
+ * 	o Neither the name of Christean van der Mijden, Heart of Technology, nor the
+ * 	  names of their contributors may be used to endorse or promote products
+ * 	  derived from this software without specific prior written permission.
+ *
+ * 	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * 	"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * 	LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * 	A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * 	HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * 	SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * 	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * 	DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * 	THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * 	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * 	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ */
+#include "embedded_scanf.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Numbers are read 8 characters at a time. The 8 characters are loaded into a
+ * single 64bits 'chunk' and checked and converted with a handful of integer
+ * operations on all 8 at once (SIMD within a register, or SWAR) instead of a
+ * loop per character.
+ *
+ * On a little endian processor the first character ends up in the lowest byte
+ * of the chunk. The conversions below depend on that.
+ */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+	#error "embedded_scanf requires a little endian target"
+#endif
+
+/*
+ * Reading a uint8_t string through a uint64_t pointer breaks the C aliasing
+ * rules, the may_alias attribute tells GCC it's on purpose.
+ */
+typedef uint64_t __attribute__((__may_alias__)) embsf_chunk_t;
+
+/* A 1 in every byte of a chunk. Multiply by it to repeat a byte 8 times */
+#define CHUNK_ONES				(0x0101010101010101ull)
+
+/* The highest bit of every byte in a chunk */
+#define CHUNK_HIGH_BITS			(0x8080808080808080ull)
+
+/*
+ * Sets the highest bit of every byte in the chunk that is larger than low
+ * AND smaller than high (both 0 - 127). The other bytes are 0.
+ *
+ * Only the lower 7 bits of every byte take part in the additions and
+ * subtractions, so nothing carries from one byte into the next. Bytes of
+ * 128 and up never match because of the '& ~chunk'.
+ * (From Sean Eron Anderson's 'Bit Twiddling Hacks': hasbetween)
+ */
+#define CHUNK_BYTES_BETWEEN(chunk, low, high)								\
+			((((CHUNK_ONES * (127u + (high))) -								\
+			   ((chunk) & (CHUNK_ONES * 127u))) &							\
+			  ~(chunk) &													\
+			  (((chunk) & (CHUNK_ONES * 127u)) + (CHUNK_ONES * (127u - (low)))))\
+			 & CHUNK_HIGH_BITS)
+
+/*
+ * Non-zero when any byte of the chunk is 0. The lowest set bit is that of the
+ * first 0 byte.
+ */
+#define CHUNK_HAS_ZERO_BYTE(chunk)											\
+			(((chunk) - CHUNK_ONES) & ~(chunk) & CHUNK_HIGH_BITS)
+
+/* Largest magnitudes that fit the 32bits destinations */
+#define LIMIT_UNSIGNED			(0xFFFFFFFFu)
+#define LIMIT_SIGNED_POSITIVE	(0x7FFFFFFFu)
+#define LIMIT_SIGNED_NEGATIVE	(0x80000000u)
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Multipliers to shift a decimal value left by 0 - 8 digits */
+static const uint32_t powersOf10[9] =
+{
+	1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u
+};
+
+
+/*******************************************************************************
+ * Private function declaration
+ ******************************************************************************/
+
+/*!
+ * @description Checks if a character is white space
+ *
+ * @param [in] character 		the character to check
+ * @return						1 for white space, 0 otherwise
+ */
+static uint8_t isWhiteSpace(uint8_t character);
+
+/*!
+ * @description Loads the next 8 characters of a string into a chunk, without
+ * reading beyond the memory the string is in
+ *
+ * @param [in] string 			the characters to load
+ * @return						the chunk, the first character in the lowest
+ * 								byte
+ */
+static uint64_t loadChunk(const uint8_t * string);
+
+/*!
+ * @description Counts the (hexa)decimal digits at the start of a chunk
+ *
+ * @param [in] chunk 			8 characters loaded with loadChunk()
+ * @param [in] isHexadecimal 	1 to count hexadecimal digits
+ * @return						number of digits before the first other
+ * 								character (0 - 8)
+ */
+static uint8_t countDigits(uint64_t chunk, uint8_t isHexadecimal);
+
+/*!
+ * @description Converts the first digitCount decimal digits of a chunk
+ *
+ * @param [in] chunk 			8 characters loaded with loadChunk()
+ * @param [in] digitCount 		the number of digits to convert (1 - 8)
+ * @return						the value of the digits
+ */
+static uint32_t convertDecimalChunk(uint64_t chunk, uint8_t digitCount);
+
+/*!
+ * @description Converts the first digitCount hexadecimal digits of a chunk
+ *
+ * @param [in] chunk 			8 characters loaded with loadChunk()
+ * @param [in] digitCount 		the number of digits to convert (1 - 8)
+ * @return						the value of the digits
+ */
+static uint32_t convertHexadecimalChunk(uint64_t chunk, uint8_t digitCount);
+
+/*!
+ * @description Reads an unsigned (hexa)decimal number from the input
+ *
+ * @param [in]  input 			pointer to the input pointer, moved beyond
+ * 								the number
+ * @param [in]  width 			maximum number of characters to read
+ * @param [in]  isHexadecimal 	1 to read a hexadecimal number
+ * @param [in]  limit 			the largest value allowed
+ * @param [out] value 			the value read
+ * @return						1 when a number was read, 0 when there are no
+ * 								digits or the number is larger than limit
+ */
+static uint8_t readNumber(const uint8_t ** input, uint32_t width,
+						  uint8_t isHexadecimal, uint32_t limit,
+						  uint32_t * value);
+
+
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : embedded_sscanf
+ * Description   : A stripped down version of the c standard sscanf function.
+ *
+ * Comments:
+ * - The format is evaluated the same way as in embedded_printf(), but instead
+ *   of passing characters to the output, they are matched against the input.
+ *
+ *END**************************************************************************/
+int32_t embedded_sscanf(const uint8_t *input, const uint8_t *format, ...)
+{
+	/* Variable to contain the list of arguments */
+	va_list arguments;
+
+	/* Variable to temporarily contain the character that is evaluated */
+	uint8_t currentCharacter;
+
+	/* Variable to keep track of the width */
+	uint32_t formatWidth;
+
+	/* Pointer to the destination of %c and %s */
+	uint8_t * destinationPtr;
+
+	/* temporary value to receive a number */
+	uint32_t u32integerNumber;
+
+	/* Set when the current number is negative */
+	uint8_t isNegative;
+
+	/* Set as long as the input matches the format */
+	uint8_t isMatching = 1u;
+
+	/* Number of variables that received a value */
+	int32_t assignedCount = 0;
+
+	/* Initialize the pointer to the variable length argument list. */
+	va_start(arguments, format);
+
+	/* Put the first character of the format into the evaluation variable */
+	currentCharacter = *(format++);
+
+	while((currentCharacter) && (1u == isMatching))
+	{
+		/* White space in the format matches any white space in the input */
+		if(isWhiteSpace(currentCharacter))
+		{
+			while(isWhiteSpace(*input))
+			{
+				input++;
+			}
+		}
+
+		/* Any other character, except a '%', must match the input exactly */
+		else if('%' != currentCharacter)
+		{
+			if(currentCharacter == *input)
+			{
+				input++;
+			}
+			else
+			{
+				isMatching = 0u;
+			}
+		}
+
+		/* When a '%' is encountered a value must be read */
+		else
+		{
+			formatWidth = 0u;
+			currentCharacter = *(format++);
+
+			/* Get the width, see embedded_printf() */
+			while(('0' <= currentCharacter) && ('9' >= currentCharacter))
+			{
+				formatWidth = (((formatWidth << 2u) + formatWidth) << 1u);
+				formatWidth += (currentCharacter - '0');
+				currentCharacter = *(format++);
+			}
+
+			/* Like embedded_printf(), the width is 8 bits */
+			formatWidth &= 0xFFu;
+
+			/* No width means no limit, except for %c which reads 1 */
+			if(0u == formatWidth)
+			{
+				formatWidth = ('c' == currentCharacter) ? 1u : 0xFFFFFFFFu;
+			}
+
+			/* All specifiers except %c skip the white space before a value */
+			if('c' != currentCharacter)
+			{
+				while(isWhiteSpace(*input))
+				{
+					input++;
+				}
+			}
+
+			switch(currentCharacter)
+			{
+				case 'i':
+				case 'd':
+					isNegative = 0u;
+
+					/* Take the sign, it counts for the width */
+					if(('-' == *input) || ('+' == *input))
+					{
+						isNegative = ('-' == *input);
+						input++;
+						formatWidth--;
+					}
+
+					/* The magnitude of a negative number can be 1 larger */
+					isMatching = readNumber(&input, formatWidth, 0u,
+											isNegative ? LIMIT_SIGNED_NEGATIVE :
+														 LIMIT_SIGNED_POSITIVE,
+											&u32integerNumber);
+
+					if(1u == isMatching)
+					{
+						/* 2's complement for negative numbers */
+						if(isNegative)
+						{
+							u32integerNumber = ((~u32integerNumber) + 1u);
+						}
+
+						*(va_arg(arguments, int32_t *)) =
+												(int32_t)u32integerNumber;
+						assignedCount++;
+					}
+					break;
+
+				case 'u':
+					isMatching = readNumber(&input, formatWidth, 0u,
+											LIMIT_UNSIGNED, &u32integerNumber);
+
+					if(1u == isMatching)
+					{
+						*(va_arg(arguments, uint32_t *)) = u32integerNumber;
+						assignedCount++;
+					}
+					break;
+
+				case 'x':
+				case 'X':
+					/*
+					 * Skip a '0x' prefix, but only when a hexadecimal digit
+					 * follows. Otherwise the '0' is the number itself.
+					 */
+					if((formatWidth > 2u) && ('0' == input[0]) &&
+					   ('x' == (input[1] | 0x20u)) &&
+					   (0u != countDigits(loadChunk(&input[2]), 1u)))
+					{
+						input += 2;
+						formatWidth -= 2u;
+					}
+
+					isMatching = readNumber(&input, formatWidth, 1u,
+											LIMIT_UNSIGNED, &u32integerNumber);
+
+					if(1u == isMatching)
+					{
+						*(va_arg(arguments, uint32_t *)) = u32integerNumber;
+						assignedCount++;
+					}
+					break;
+
+				case 'c':
+					destinationPtr = va_arg(arguments, uint8_t *);
+
+					/* Copy exactly formatWidth characters */
+					while((formatWidth > 0u) && (*input))
+					{
+						*(destinationPtr++) = *(input++);
+						formatWidth--;
+					}
+
+					if(0u == formatWidth)
+					{
+						assignedCount++;
+					}
+					else
+					{
+						isMatching = 0u;
+					}
+					break;
+
+				case 's':
+					destinationPtr = va_arg(arguments, uint8_t *);
+
+					/* Copy up to the next white space, at least 1 character */
+					if(0u == *input)
+					{
+						isMatching = 0u;
+					}
+					else
+					{
+						while((formatWidth > 0u) && (*input) &&
+							  (!isWhiteSpace(*input)))
+						{
+							*(destinationPtr++) = *(input++);
+							formatWidth--;
+						}
+
+						*destinationPtr = '\0';
+						assignedCount++;
+					}
+					break;
+
+				case '%':
+					if('%' == *input)
+					{
+						input++;
+					}
+					else
+					{
+						isMatching = 0u;
+					}
+					break;
+
+				default:
+					/* Unsupported specifier (or end of format) */
+					isMatching = 0u;
+					break;
+			} /* switch(currentCharacter) */
+
+		} /* '%' == currentCharacter */
+
+		/* Get next character */
+		currentCharacter = *(format++);
+
+	} /* while(currentCharacter) */
+
+	/* Cleanup the variable length argument list. */
+	va_end(arguments);
+
+	return assignedCount;
+}
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : isWhiteSpace
+ * Description   : Checks if a character is white space (' ', \t, \n, \v, \f,
+ * 				   \r)
+ *
+ *END**************************************************************************/
+static uint8_t isWhiteSpace(uint8_t character)
+{
+	return ((' ' == character) ||
+			(('\t' <= character) && ('\r' >= character)));
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : loadChunk
+ * Description   : Loads the next 8 characters of a string into a chunk
+ *
+ * Comments:
+ * - Simply reading 8 characters could read beyond the end of the string and
+ *   into memory that does not exist, or that the MPU doesn't allow us to
+ *   read. Memory is always divided on 8 byte boundaries though. So reading
+ *   the aligned 8 bytes around the first character is always allowed.
+ * - When the string starts in the middle of those 8 bytes, the remaining
+ *   characters come from the next aligned 8 bytes. These are only read if
+ *   the string does not end (has no '\0') before them.
+ * - The characters beyond the '\0' are whatever the aligned 8 bytes hold
+ *   (they are only 0 when shifted in, i.e. when the string doesn't start on an
+ *   8 byte boundary). The callers don't look at them: countDigits() stops at
+ *   the first non digit, which the '\0' is.
+ * - AddressSanitizer doesn't know about the aligned blocks and would report
+ *   the bytes outside the string, so it is switched off for this function.
+ *   With EMBPF_USE_WORD_READS set to 0 the characters are loaded one by one,
+ *   up to the '\0', e.g. for valgrind. Then the characters beyond the '\0'
+ *   are 0.
+ *
+ *END**************************************************************************/
+#if (1 == EMBPF_USE_WORD_READS)
+EMBPF_NO_SANITIZE_ADDRESS
+static uint64_t loadChunk(const uint8_t * string)
+{
+	/* Position of the string within the aligned 8 bytes */
+	uint32_t offset = ((uintptr_t)string & 0x7u);
+
+	/* Pointer to the aligned 8 bytes holding the first character */
+	const embsf_chunk_t * alignedPtr = (const embsf_chunk_t *)(string - offset);
+
+	/* The first character ends up in the lowest byte */
+	uint64_t chunk = (alignedPtr[0] >> (offset << 3u));
+
+	if(0u != offset)
+	{
+		/*
+		 * Only the first 8 - offset bytes came from the string. Fill the
+		 * others (which were shifted in as 0) with 0xFF before checking for a
+		 * '\0' terminator.
+		 */
+		if(0u == CHUNK_HAS_ZERO_BYTE(chunk |
+									 (~0ull << ((8u - offset) << 3u))))
+		{
+			chunk |= (alignedPtr[1] << ((8u - offset) << 3u));
+		}
+	}
+
+	return chunk;
+}
+#else
+static uint64_t loadChunk(const uint8_t * string)
+{
+	/* Number of characters loaded so far */
+	uint32_t characterCount = 0u;
+
+	uint64_t chunk = 0u;
+
+	/* The first character ends up in the lowest byte */
+	while((8u > characterCount) && (string[characterCount]))
+	{
+		chunk |= ((uint64_t)string[characterCount] << (characterCount << 3u));
+		characterCount++;
+	}
+
+	return chunk;
+}
+#endif /* EMBPF_USE_WORD_READS */
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : countDigits
+ * Description   : Counts the (hexa)decimal digits at the start of a chunk
+ *
+ * Comments:
+ * - Every byte that is not a digit gets its highest bit set. The lowest of
+ *   those (the first character in the string that is not a digit) is found
+ *   by counting the trailing zero bits, 8 per byte.
+ * - Decimal digits are 0x30 - 0x39. Adding 0x46 sets the highest bit of
+ *   everything above 0x39, subtracting 0x30 sets it for everything below
+ *   0x30 (and above 0xAF). An addition or subtraction can carry into the next
+ *   byte, but only from a byte that isn't a digit. The next byte comes later
+ *   in the string, so it doesn't matter anymore.
+ * - Hexadecimal digits are 3 ranges, those are checked with
+ *   CHUNK_BYTES_BETWEEN instead.
+ *
+ *END**************************************************************************/
+static uint8_t countDigits(uint64_t chunk, uint8_t isHexadecimal)
+{
+	/* Highest bit set for every character that is not a digit */
+	uint64_t otherBits;
+
+	if(isHexadecimal)
+	{
+		otherBits = (CHUNK_BYTES_BETWEEN(chunk, '0' - 1u, '9' + 1u) |
+					 CHUNK_BYTES_BETWEEN(chunk, 'A' - 1u, 'F' + 1u) |
+					 CHUNK_BYTES_BETWEEN(chunk, 'a' - 1u, 'f' + 1u));
+		otherBits = ((~otherBits) & CHUNK_HIGH_BITS);
+	}
+	else
+	{
+		otherBits = (((chunk + (CHUNK_ONES * 0x46u)) |
+					  (chunk - (CHUNK_ONES * '0'))) & CHUNK_HIGH_BITS);
+	}
+
+	if(0u == otherBits)
+	{
+		return 8u;
+	}
+
+	return (uint8_t)(__builtin_ctzll(otherBits) >> 3u);
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : convertDecimalChunk
+ * Description   : Converts the first digitCount decimal digits of a chunk
+ *
+ * Comments:
+ * - First the chunk is shifted up, so the characters that are not part of
+ *   the number drop off the top and zeros (leading zeros, so harmless) come
+ *   in at the bottom. '0' - '9' are 0x30 - 0x39, so the lower 4 bits of every
+ *   byte are the value of the digit.
+ * - Then neighbouring digits are combined, each step halving the number of
+ *   values and doubling their size. E.g. for "12345678":
+ *   1) 8 bytes 1,2,3,...       -> 4 x 16 bits: 1*10 + 2 = 12, 34, 56, 78
+ *   2) 4 x 16 bits 12,34,56,78 -> 2 x 32 bits: 12*100 + 34 = 1234, 5678
+ *   3) 2 x 32 bits 1234,5678   -> 1 x 64 bits: 1234*10000 + 5678
+ *   Each step is a single multiplication: multiplying by (10 * 256 + 1)
+ *   adds 10 * the first digit (lowest byte) to the second one, one byte up.
+ *   The shift brings the sum back into place.
+ *
+ *END**************************************************************************/
+static uint32_t convertDecimalChunk(uint64_t chunk, uint8_t digitCount)
+{
+	chunk <<= ((8u - digitCount) << 3u);
+	chunk &= 0x0F0F0F0F0F0F0F0Full;
+
+	chunk = ((chunk * ((10ull << 8u) + 1u)) >> 8u);
+	chunk = (((chunk & 0x00FF00FF00FF00FFull) * ((100ull << 16u) + 1u)) >> 16u);
+	chunk = (((chunk & 0x0000FFFF0000FFFFull) * ((10000ull << 32u) + 1u)) >> 32u);
+
+	return (uint32_t)chunk;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : convertHexadecimalChunk
+ * Description   : Converts the first digitCount hexadecimal digits of a chunk
+ *
+ * Comments:
+ * - Same principle as convertDecimalChunk(), but now with powers of 16.
+ * - The lower 4 bits of '0' - '9' are their value. Those of 'A' - 'F' and
+ *   'a' - 'f' are 1 - 6, so 9 must be added to get 10 - 15. Letters are the
+ *   only ones with bit 6 set (0x40), so that bit selects where to add 9.
+ *
+ *END**************************************************************************/
+static uint32_t convertHexadecimalChunk(uint64_t chunk, uint8_t digitCount)
+{
+	chunk <<= ((8u - digitCount) << 3u);
+	chunk = ((chunk & 0x0F0F0F0F0F0F0F0Full) +
+			 (((chunk >> 6u) & CHUNK_ONES) * 9u));
+
+	chunk = ((chunk * ((16ull << 8u) + 1u)) >> 8u);
+	chunk = (((chunk & 0x00FF00FF00FF00FFull) * ((256ull << 16u) + 1u)) >> 16u);
+	chunk = (((chunk & 0x0000FFFF0000FFFFull) * ((65536ull << 32u) + 1u)) >> 32u);
+
+	return (uint32_t)chunk;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : readNumber
+ * Description   : Reads an unsigned (hexa)decimal number from the input
+ *
+ * Comments:
+ * - The number is read 8 digits at a time. A 32bits number has at most 10
+ *   decimal or 8 hexadecimal digits, so usually 1 or 2 chunks. Leading zeros
+ *   don't count, there may be any number of them.
+ * - The value is kept in 64 bits. As soon as it exceeds the limit the number
+ *   doesn't fit. Since the value is then still below 2^32, adding another
+ *   8 digits can't overflow the 64 bits.
+ *
+ *END**************************************************************************/
+static uint8_t readNumber(const uint8_t ** input, uint32_t width,
+						  uint8_t isHexadecimal, uint32_t limit,
+						  uint32_t * value)
+{
+	/* 8 characters of the input */
+	uint64_t chunk;
+
+	/* The value read so far */
+	uint64_t u64integerNumber = 0u;
+
+	/* Number of digits in the current chunk */
+	uint8_t digitCount;
+
+	/* Set once at least 1 digit is read */
+	uint8_t hasDigits = 0u;
+
+	do
+	{
+		chunk = loadChunk(*input);
+		digitCount = countDigits(chunk, isHexadecimal);
+
+		/* Don't read beyond the width */
+		if(digitCount > width)
+		{
+			digitCount = (uint8_t)width;
+		}
+
+		if(0u == digitCount)
+		{
+			break;
+		}
+
+		if(isHexadecimal)
+		{
+			u64integerNumber = ((u64integerNumber << (digitCount << 2u)) |
+							convertHexadecimalChunk(chunk, digitCount));
+		}
+		else
+		{
+			u64integerNumber = ((u64integerNumber * powersOf10[digitCount]) +
+							convertDecimalChunk(chunk, digitCount));
+		}
+
+		if(u64integerNumber > limit)
+		{
+			return 0u;
+		}
+
+		(*input) += digitCount;
+		width -= digitCount;
+		hasDigits = 1u;
+
+	} while(8u == digitCount);
+
+	*value = (uint32_t)u64integerNumber;
+
+	return hasDigits;
+}
+
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,157 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embedded_scanf.h
+ *		Author	  	: Christean van der Mijden
+ *		Date		: 18 October 2026
+ *		Version		: 1.00
+ *
+ *		Project		: N/A
+ *		Processor	: N/A
+ *		Component	: stripped down sscanf for embedded applications
+ *		Compiler	: GCC ARM
+ *
+ *	Revision History:
+ *	------------------------------------------------------------------------
+ *	18 October 2026			version 1
+ *
+ *
+ *
+ *	@license
+ *
+ *	This library is free software; you can redistribute it and/or modify it
+ *	under the terms of the GNU Lesser General Public License as published by the
+ *	Free Software Foundation; either version 3.0 of the License, or (at your
+ *	option) any later version.
+ *
+ *	The GNU Lesser General Public License v3.0 can be found here:
+ *
+ *			http://www.gnu.org/licenses/lgpl-3.0.en.html
+ *
+ *
+ *	In addition the following applies:
+ *
+ * 	Redistribution and use in source and binary forms, with or without
+ * 	modification, are permitted provided that the following conditions
+ * 	are met:
+ *
+ * 	o Redistributions of source code must retain the above copyright
+ * 	  notice, this list of conditions and the following disclaimer.
+ *
+ * 	o Redistributions in binary form must reproduce the above copyright
+ * 	  notice, this list of conditions and the following disclaimer in the
+ * 	  documentation and/or other materials provided with the distribution.
+ *
+ * 	o Neither the name of Christean van der Mijden, Heart of Technology, nor the
+ * 	  names of their contributors may be used to endorse or promote products
+ * 	  derived from this software without specific prior written permission.
+ *
+ * 	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * 	"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * 	LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * 	A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * 	HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * 	SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * 	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * 	DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * 	THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * 	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * 	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ */
+#ifndef __EMBEDDED_SCANF_H_
+#define __EMBEDDED_SCANF_H_
+
+
+/*! @file
+ *
+ * Embedded sscanf is the input side counterpart of embedded printf: a stripped
+ * down version of the c standard sscanf function that understands the same
+ * reduced format tags as embedded_printf().
+ *
+ * The c standard library sscanf is, just like printf, big and slow. Most of
+ * the time it's only used to get a few numbers out of a command line or a
+ * configuration file. Embedded sscanf does just that, but converts the numbers
+ * up to 8 digits at a time (see embedded_scanf.c for how that's done).
+ *
+ * To use this library:
+ *
+ * 1: Compile embedded_scanf.c with your project. It does not need the output
+ *    definitions of embedded printf.
+ * 2: The target must be little endian (as ARM Cortex-M normally is).
+ * 3: Optional: numbers are read in aligned blocks of 8 characters, which may
+ *    read up to 7 characters beyond the '\0' (harmless on the target). Set
+ *    EMBPF_USE_WORD_READS in embedded_printf_config.h to 0 to read one
+ *    character at a time instead, e.g. for host builds under valgrind.
+ *
+ */
+#include <stdarg.h> 	/*<! required for the va_list library functions */
+#include <stdint.h>		/*<! definition for platform independent types */
+#include "embedded_printf_config.h"	/*<! EMBPF_USE_WORD_READS */
+
+
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Reads formatted data from a string
+ *
+ * @param [in]  input	The '\0' terminated string to read from
+ * @param [in]  format	The format the input is expected to have
+ * @param [out] ...		pointers to the variables that receive the values
+ * @return				the number of variables that received a value
+ *
+ * @Description
+ *
+ * Embedded sscanf stripped down formatting tag prototype:
+ *
+ * %[width]specifier
+ *
+ * Supported width:
+ * Up to 255, the maximum number of characters to read for the tag
+ *
+ * Supported specifiers:
+ * c	single character, or 'width' characters (no '\0' is added)
+ * d	signed decimal integer (int32_t *)
+ * i	<same as d>
+ * s	string of characters up to the next white space ('\0' is added)
+ * u	unsigned decimal integer (uint32_t *)
+ * x	unsigned hexadecimal integer (uint32_t *), optionally preceded by 0x
+ * X	<same as x>
+ * %	matches a '%'
+ *
+ * White space in the format matches any amount of white space in the input
+ * (including none). All other characters must match exactly. All specifiers,
+ * except c, skip white space in the input before reading the value.
+ *
+ * Reading stops at the first character that doesn't match the format.
+ *
+ * @Note
+ * 1. All integers are 32 bits
+ * 2. A number that doesn't fit in 32 bits is a mismatch, it is not truncated
+ * 3. Only %d and %i accept a sign ('+' or '-')
+ * 4. Empty input (or input that ends before the first value) returns 0, where
+ *    the c standard sscanf returns EOF. Code that tests for EOF must test for
+ *    0 instead.
+ */
+int32_t embedded_sscanf(const uint8_t *input, const uint8_t *format, ...);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif /* __EMBEDDED_SCANF_H_ */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
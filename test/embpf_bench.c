@@ -0,0 +1,78 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embpf_bench.c
+ *		Component	: host benchmark of embedded_printf()
+ *
+ *	Prints a fixed mix of format tags to an output function that only stores
+ *	the last character, and reports the average time per call. Build it once
+ *	per configuration (tools/tier_report.sh does this for every tier); the
+ *	numbers are only meaningful relative to each other on the same machine.
+ *
+ *	Usage: embpf_bench [calls]
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "host_port.h"
+#include "embedded_printf.h"
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Last character printed, keeps the compiler from dropping the output */
+static volatile uint8_t lastCharacter;
+
+
+/*******************************************************************************
+ * Host port
+ ******************************************************************************/
+
+void UART_PutChar(uint8_t character)
+{
+	lastCharacter = character;
+}
+
+uint32_t SYSTICK_GetTicks(void)
+{
+	return 0u;
+}
+
+
+/*******************************************************************************
+ * Benchmark
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+	long calls = (argc > 1) ? atol(argv[1]) : 2000000l;
+	uint32_t value = 0u;
+	struct timespec start;
+	struct timespec stop;
+	long call;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for(call = 0; call < calls; call++)
+	{
+		value = (value * 1664525u) + 1013904223u;
+		embedded_printf((const uint8_t *)"v=%u x=%08x d=%d s=%s\r\n",
+						value, value >> 3, (int32_t)value >> 20, "ok");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+
+	printf("%.1f\n", (((double)(stop.tv_sec - start.tv_sec) * 1e9) +
+					  (double)(stop.tv_nsec - start.tv_nsec)) / (double)calls);
+
+	return 0;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
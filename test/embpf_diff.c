@@ -0,0 +1,749 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embpf_diff.c
+ *		Component	: host test, embedded_printf() variants against the
+ *					  reference and against snprintf()
+ *
+ *	embedded_printf.c is built once per variant with its symbol renamed
+ *	(see the Makefile), next to the 1.01 version in reference/ which defines
+ *	the expected output:
+ *
+ *		reference	 reference/embedded_printf.c, version 1.01
+ *		minimal		 EMBPF_TIER_MINIMAL
+ *		unsigned	 EMBPF_TIER_MINIMAL without EMBPF_USE_SIGNED
+ *		default		 EMBPF_TIER_DEFAULT
+ *		fast		 EMBPF_TIER_FAST
+ *		verify		 EMBPF_TIER_FAST with EMBPF_VERIFY_DIGIT_ENGINE
+ *		features	 EMBPF_TIER_DEFAULT with the rate limiter and
+ *					 embedded_printf_kv() compiled in
+ *
+ *	All variants print through UART_PutChar(), which collects the output in
+ *	a buffer. Every variant must produce the same bytes as the reference. The
+ *	unsigned variant prints %d and %i as %u, so it is compared with the
+ *	reference output of the same format with %u instead.
+ *
+ *	The random formats are also compared with snprintf(), tag by tag. Where
+ *	embedded printf differs from C on purpose the expected output is adjusted
+ *	and the difference is counted, see allowedDifferenceNames[]:
+ *
+ *	- zero padding goes before the '-': %05d of -42 is 00-42, not -0042
+ *	- zero padding is also done for %c and %s (undefined in C)
+ *	- the width is 8 bits: %300u is %44u
+ *	- %c of '\0' prints nothing but the padding
+ *	- an unknown specifier prints nothing but the padding (undefined in C)
+ *	- a format ending inside a tag (e.g. "%5") prints the padding and stops.
+ *	  Version 1.01 reads one byte beyond the '\0' then, so all formats are
+ *	  given two '\0'.
+ *
+ *	A width smaller than the string never cuts it off; this is the same as
+ *	in C and so simply compared.
+ *
+ *	The arguments are passed as uintptr_t, whatever the tag, so any format
+ *	can be fed with a fixed argument list. On the LP64 hosts this is meant for
+ *	every integer argument takes a full slot and va_arg(uint32_t) reads its
+ *	lower half.
+ *
+ *	Usage:
+ *		embpf_diff [iterations] [seed]		random formats, then ns/call
+ *		embpf_diff -r file...				replay fuzzer inputs
+ *
+ *	Built with -DFUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION and
+ *	-fsanitize=fuzzer, LLVMFuzzerTestOneInput() is the entry instead of
+ *	main(). The first 32 bytes of the input are the argument values, the
+ *	rest is the format.
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_port.h"
+
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Number of arguments passed to every call */
+#define ARGUMENT_COUNT					(8u)
+
+/*!< Maximum length of a format, without the two '\0' */
+#define FORMAT_SIZE						(256u)
+
+/*!< Size of the output capture buffer */
+#define CAPTURE_SIZE					(65536u)
+
+/*!< Number of random formats the time per call is measured with */
+#define TIMING_CASES					(256u)
+
+/* Allowed differences with snprintf() */
+#define ALLOWED_ZERO_BEFORE_SIGN		(0u)
+#define ALLOWED_ZERO_PADDED_TEXT		(1u)
+#define ALLOWED_WIDTH_WRAP				(2u)
+#define ALLOWED_NUL_CHARACTER			(3u)
+#define ALLOWED_UNKNOWN_SPECIFIER		(4u)
+#define ALLOWED_UNTERMINATED			(5u)
+#define ALLOWED_COUNT					(6u)
+
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+typedef void (*printFunction_t)(const uint8_t *format, ...);
+
+typedef struct
+{
+	const char * name;
+	printFunction_t print;
+	uint8_t hasSigned;		/*!< 0: %d and %i are printed as %u */
+} variant_t;
+
+typedef struct
+{
+	uint8_t format[FORMAT_SIZE + 2u];			/*!< ends with two '\0' */
+	uint8_t unsignedFormat[FORMAT_SIZE + 2u];	/*!< %d and %i as %u */
+	uintptr_t arguments[ARGUMENT_COUNT];
+} testCase_t;
+
+
+/*******************************************************************************
+ * Variants, see the Makefile
+ ******************************************************************************/
+
+void embpf_reference_printf(const uint8_t *format, ...);
+void embpf_minimal_printf(const uint8_t *format, ...);
+void embpf_unsigned_printf(const uint8_t *format, ...);
+void embpf_default_printf(const uint8_t *format, ...);
+void embpf_fast_printf(const uint8_t *format, ...);
+void embpf_verify_printf(const uint8_t *format, ...);
+void embpf_features_printf(const uint8_t *format, ...);
+
+/* The reference must be the first */
+static const variant_t variants[] =
+{
+	{ "reference",	embpf_reference_printf,	1u },
+	{ "minimal",	embpf_minimal_printf,	1u },
+	{ "unsigned",	embpf_unsigned_printf,	0u },
+	{ "default",	embpf_default_printf,	1u },
+	{ "fast",		embpf_fast_printf,		1u },
+	{ "verify",		embpf_verify_printf,	1u },
+	{ "features",	embpf_features_printf,	1u },
+};
+
+#define VARIANT_COUNT					(sizeof(variants) / sizeof(variants[0]))
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Strings for %s, selected by the argument value */
+static const char * const strings[] =
+{
+	"", "a", "str", "toolong string", "\xc3\xa9t\xc3\xa9", "\t\r\n\"\\"
+};
+
+#define STRING_COUNT					(sizeof(strings) / sizeof(strings[0]))
+
+static const char * const allowedDifferenceNames[ALLOWED_COUNT] =
+{
+	"zero padding before the '-'",
+	"zero padding of %c and %s",
+	"width modulo 256",
+	"%c of '\\0'",
+	"unknown specifier",
+	"format ending inside a tag",
+};
+
+/* Output of the variant that was called last */
+static uint8_t captured[CAPTURE_SIZE];
+static size_t capturedLength;
+
+/* Output of the reference */
+static uint8_t referenceOutput[CAPTURE_SIZE];
+static size_t referenceLength;
+static uint8_t unsignedReferenceOutput[CAPTURE_SIZE];
+static size_t unsignedReferenceLength;
+
+/* State of the xorshift random generator */
+static uint64_t randomState = 88172645463325252ull;
+
+
+/*******************************************************************************
+ * Host port
+ ******************************************************************************/
+
+void UART_PutChar(uint8_t character)
+{
+	if(capturedLength < CAPTURE_SIZE)
+	{
+		captured[capturedLength++] = character;
+	}
+}
+
+uint32_t SYSTICK_GetTicks(void)
+{
+	return 0u;
+}
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static uint32_t randomNumber(void)
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return (uint32_t)randomState;
+}
+
+static uint8_t takesArgument(uint8_t specifier)
+{
+	return (0 != specifier) && (NULL != strchr("diuxXcs", specifier));
+}
+
+/* Prints a string with the non printable characters escaped */
+static void printEscaped(const uint8_t * string, size_t length)
+{
+	size_t index;
+
+	putchar('"');
+	for(index = 0u; index < length; index++)
+	{
+		if((string[index] < ' ') || (string[index] > '~') ||
+		   ('"' == string[index]) || ('\\' == string[index]))
+		{
+			printf("\\x%02x", string[index]);
+		}
+		else
+		{
+			putchar(string[index]);
+		}
+	}
+	putchar('"');
+}
+
+static void runVariant(const variant_t * variant, const uint8_t * format,
+					   const uintptr_t * arguments)
+{
+	capturedLength = 0u;
+	variant->print(format, arguments[0], arguments[1], arguments[2],
+				   arguments[3], arguments[4], arguments[5], arguments[6],
+				   arguments[7]);
+}
+
+/*
+ * Completes a test case of which only the format is filled in: walks the tags
+ * the same way embedded_printf() does, gives every tag that takes an argument
+ * one of the values, and makes the %u version of the format. A format with
+ * more tags than arguments is cut off before the first tag without one.
+ */
+static void prepareCase(testCase_t * testCase, const uint32_t * values)
+{
+	uint8_t * format = testCase->format;
+	uint32_t argumentIndex = 0u;
+	uint8_t * tag;
+
+	memset(testCase->arguments, 0, sizeof(testCase->arguments));
+
+	while(*format)
+	{
+		if('%' != *format)
+		{
+			format++;
+			continue;
+		}
+
+		tag = format++;
+		if('0' == *format)
+		{
+			format++;
+		}
+		while(('0' <= *format) && ('9' >= *format))
+		{
+			format++;
+		}
+
+		if(takesArgument(*format))
+		{
+			if(ARGUMENT_COUNT == argumentIndex)
+			{
+				*tag = '\0';
+				break;
+			}
+
+			if('s' == *format)
+			{
+				testCase->arguments[argumentIndex] =
+					(uintptr_t)strings[values[argumentIndex] % STRING_COUNT];
+			}
+			else
+			{
+				testCase->arguments[argumentIndex] = values[argumentIndex];
+			}
+			argumentIndex++;
+		}
+
+		if('\0' == *format)
+		{
+			break;
+		}
+		format++;
+	}
+
+	memcpy(testCase->unsignedFormat, testCase->format, sizeof(testCase->format));
+
+	/* Same walk, now only to replace the signed specifiers */
+	format = testCase->unsignedFormat;
+	while(*format)
+	{
+		if('%' == *(format++))
+		{
+			if('0' == *format)
+			{
+				format++;
+			}
+			while(('0' <= *format) && ('9' >= *format))
+			{
+				format++;
+			}
+			if(('d' == *format) || ('i' == *format))
+			{
+				*format = 'u';
+			}
+			if(*format)
+			{
+				format++;
+			}
+		}
+	}
+}
+
+/*
+ * Runs all variants on a test case and compares their output with the
+ * reference. Returns the number of variants that differ.
+ */
+static uint32_t checkVariants(const testCase_t * testCase)
+{
+	/* Variants get a copy without the second '\0': ASan sees overreads */
+	size_t formatSize = strlen((const char *)testCase->format) + 1u;
+	uint8_t * format = malloc(formatSize);
+	uint32_t failures = 0u;
+	size_t variant;
+
+	if(NULL == format)
+	{
+		abort();
+	}
+	memcpy(format, testCase->format, formatSize);
+
+	runVariant(&variants[0], testCase->format, testCase->arguments);
+	memcpy(referenceOutput, captured, capturedLength);
+	referenceLength = capturedLength;
+
+	runVariant(&variants[0], testCase->unsignedFormat, testCase->arguments);
+	memcpy(unsignedReferenceOutput, captured, capturedLength);
+	unsignedReferenceLength = capturedLength;
+
+	for(variant = 1u; variant < VARIANT_COUNT; variant++)
+	{
+		const uint8_t * expected = variants[variant].hasSigned ?
+								   referenceOutput : unsignedReferenceOutput;
+		size_t expectedLength = variants[variant].hasSigned ?
+								referenceLength : unsignedReferenceLength;
+
+		runVariant(&variants[variant], format, testCase->arguments);
+
+		if((capturedLength != expectedLength) ||
+		   (0 != memcmp(captured, expected, expectedLength)))
+		{
+			failures++;
+			printf("FAIL %s: format ", variants[variant].name);
+			printEscaped(testCase->format, strlen((const char *)testCase->format));
+			printf("\n  reference ");
+			printEscaped(expected, expectedLength);
+			printf("\n  %-9s ", variants[variant].name);
+			printEscaped(captured, capturedLength);
+			printf("\n");
+		}
+	}
+
+	free(format);
+
+	return failures;
+}
+
+/* Appends 'count' padding characters to the expected output */
+static size_t putExpectedPadding(uint8_t * expected, uint8_t character, uint32_t count)
+{
+	memset(expected, character, count);
+	return count;
+}
+
+/*
+ * Generates a random format with its arguments and the output C would give,
+ * adjusted for the allowed differences. Returns the length of that output.
+ */
+static size_t generateCase(testCase_t * testCase, uint8_t * expected,
+						   uint32_t * allowed)
+{
+	static const char literals[] = "abc XYZ:=-0123,.\t\r\n";
+	static const char specifiers[] = "diuxXcs%q";
+	uint32_t values[ARGUMENT_COUNT] = { 0u };
+	uint32_t argumentIndex = 0u;
+	size_t formatLength = 0u;
+	size_t expectedLength = 0u;
+
+	memset(testCase->format, 0, sizeof(testCase->format));
+
+	while((formatLength < (FORMAT_SIZE - 32u)) && (0u != (randomNumber() % 12u)))
+	{
+		char tag[16];
+		char piece[32];
+		char specifier;
+		uint8_t useZeroPadding;
+		uint32_t width = 0u;
+		uint32_t effectiveWidth;
+		uint32_t value = 0u;
+		int length;
+
+		/* Some literal text first */
+		while(0u != (randomNumber() % 3u))
+		{
+			uint8_t literal = (uint8_t)literals[randomNumber() % (sizeof(literals) - 1u)];
+			testCase->format[formatLength++] = literal;
+			expected[expectedLength++] = literal;
+		}
+
+		/* Then a tag */
+		specifier = specifiers[randomNumber() % (sizeof(specifiers) - 1u)];
+		if(takesArgument((uint8_t)specifier) && (ARGUMENT_COUNT == argumentIndex))
+		{
+			break;
+		}
+
+		if('%' == specifier)
+		{
+			/* C gives %% no flags or width */
+			testCase->format[formatLength++] = '%';
+			testCase->format[formatLength++] = '%';
+			expected[expectedLength++] = '%';
+			continue;
+		}
+
+		useZeroPadding = (0u == (randomNumber() % 3u));
+		switch(randomNumber() % 8u)
+		{
+			case 0:	 width = 256u + (randomNumber() % 400u);	break;
+			case 1:
+			case 2:
+			case 3:	 width = 1u + (randomNumber() % 20u);		break;
+			default: width = 0u;								break;
+		}
+		effectiveWidth = width % 256u;
+		if(width >= 256u)
+		{
+			allowed[ALLOWED_WIDTH_WRAP]++;
+		}
+
+		/* Argument */
+		if(takesArgument((uint8_t)specifier))
+		{
+			switch(randomNumber() % 5u)
+			{
+				case 0:	 value = 0u;								break;
+				case 1:	 value = randomNumber() % 100u;				break;
+				case 2:	 value = 0x80000000u >> (randomNumber() % 2u);
+						 value -= (randomNumber() % 2u);			break;
+				case 3:	 value = (uint32_t)-(int32_t)(randomNumber() % 1000u);	break;
+				default: value = randomNumber();					break;
+			}
+			if('c' == specifier)
+			{
+				value = (0u == (randomNumber() % 16u)) ? 0u : (1u + (randomNumber() % 255u));
+			}
+			values[argumentIndex++] = value;
+		}
+
+		/* The tag as written in the format */
+		sprintf(tag, "%%%s", useZeroPadding ? "0" : "");
+		if(width)
+		{
+			sprintf(&tag[strlen(tag)], "%u", width);
+		}
+		sprintf(&tag[strlen(tag)], "%c", specifier);
+		memcpy(&testCase->format[formatLength], tag, strlen(tag));
+		formatLength += strlen(tag);
+
+		/* What C prints for the value alone */
+		switch(specifier)
+		{
+			case 'd':
+			case 'i': length = snprintf(piece, sizeof(piece), "%d", (int32_t)value);	break;
+			case 'u': length = snprintf(piece, sizeof(piece), "%u", value);				break;
+			case 'x': length = snprintf(piece, sizeof(piece), "%x", value);				break;
+			case 'X': length = snprintf(piece, sizeof(piece), "%X", value);				break;
+			case 'c': length = snprintf(piece, sizeof(piece), "%c", (int)value);			break;
+			case 's': length = snprintf(piece, sizeof(piece), "%s", strings[value % STRING_COUNT]);	break;
+			default:  length = 0;														break;
+		}
+
+		if(('c' == specifier) && (0u == value))
+		{
+			allowed[ALLOWED_NUL_CHARACTER]++;
+			length = 0;
+		}
+		else if('q' == specifier)
+		{
+			allowed[ALLOWED_UNKNOWN_SPECIFIER]++;
+		}
+
+		if(effectiveWidth <= (uint32_t)length)
+		{
+			/* No padding: C prints exactly the same */
+			memcpy(&expected[expectedLength], piece, (size_t)length);
+			expectedLength += (size_t)length;
+		}
+		else if(useZeroPadding && ('-' == piece[0]) && (('d' == specifier) || ('i' == specifier)))
+		{
+			allowed[ALLOWED_ZERO_BEFORE_SIGN]++;
+			expectedLength += putExpectedPadding(&expected[expectedLength], '0',
+												 effectiveWidth - (uint32_t)length);
+			memcpy(&expected[expectedLength], piece, (size_t)length);
+			expectedLength += (size_t)length;
+		}
+		else if(('q' == specifier) || (0 == length))
+		{
+			/* Only the padding is printed */
+			expectedLength += putExpectedPadding(&expected[expectedLength],
+												 useZeroPadding ? '0' : ' ',
+												 effectiveWidth);
+		}
+		else if(useZeroPadding && (('c' == specifier) || ('s' == specifier)))
+		{
+			allowed[ALLOWED_ZERO_PADDED_TEXT]++;
+			expectedLength += putExpectedPadding(&expected[expectedLength], '0',
+												 effectiveWidth - (uint32_t)length);
+			memcpy(&expected[expectedLength], piece, (size_t)length);
+			expectedLength += (size_t)length;
+		}
+		else
+		{
+			/* Let C do the padding, with the 8 bits width */
+			char effectiveTag[16];
+
+			sprintf(effectiveTag, "%%%s%u%c", useZeroPadding ? "0" : "",
+					effectiveWidth, specifier);
+			if('s' == specifier)
+			{
+				length = snprintf((char *)&expected[expectedLength], 300u, effectiveTag,
+								  strings[value % STRING_COUNT]);
+			}
+			else if(('d' == specifier) || ('i' == specifier))
+			{
+				length = snprintf((char *)&expected[expectedLength], 300u, effectiveTag,
+								  (int32_t)value);
+			}
+			else
+			{
+				length = snprintf((char *)&expected[expectedLength], 300u, effectiveTag,
+								  value);
+			}
+			expectedLength += (size_t)length;
+		}
+	}
+
+	/* Sometimes end inside a tag: only the padding is printed */
+	if(0u == (randomNumber() % 20u))
+	{
+		uint32_t width = randomNumber() % 12u;
+		uint8_t useZeroPadding = (uint8_t)(randomNumber() & 1u);
+
+		allowed[ALLOWED_UNTERMINATED]++;
+		formatLength += (size_t)sprintf((char *)&testCase->format[formatLength], "%%%s",
+										useZeroPadding ? "0" : "");
+		if(width)
+		{
+			formatLength += (size_t)sprintf((char *)&testCase->format[formatLength],
+											"%u", width);
+		}
+		expectedLength += putExpectedPadding(&expected[expectedLength],
+											 useZeroPadding ? '0' : ' ', width);
+	}
+
+	prepareCase(testCase, values);
+
+	return expectedLength;
+}
+
+static double now(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+
+/*******************************************************************************
+ * Fuzzer entry
+ ******************************************************************************/
+
+int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
+{
+	static testCase_t testCase;
+	uint32_t values[ARGUMENT_COUNT] = { 0u };
+	size_t valueBytes = (size < sizeof(values)) ? size : sizeof(values);
+	size_t formatLength = size - valueBytes;
+
+	memcpy(values, data, valueBytes);
+
+	if(formatLength > FORMAT_SIZE)
+	{
+		formatLength = FORMAT_SIZE;
+	}
+	memset(testCase.format, 0, sizeof(testCase.format));
+	memcpy(testCase.format, &data[valueBytes], formatLength);
+
+	prepareCase(&testCase, values);
+
+	if(0u != checkVariants(&testCase))
+	{
+		abort();
+	}
+
+	return 0;
+}
+
+
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+
+/*******************************************************************************
+ * Test
+ ******************************************************************************/
+
+static int replayFiles(int count, char ** names)
+{
+	static uint8_t data[FORMAT_SIZE + (4u * ARGUMENT_COUNT)];
+	int index;
+
+	for(index = 0; index < count; index++)
+	{
+		FILE * file = fopen(names[index], "rb");
+		size_t size;
+
+		if(NULL == file)
+		{
+			perror(names[index]);
+			return 2;
+		}
+		size = fread(data, 1u, sizeof(data), file);
+		fclose(file);
+
+		LLVMFuzzerTestOneInput(data, size);
+	}
+
+	printf("embpf_diff: %d inputs replayed\n", count);
+	return 0;
+}
+
+int main(int argc, char ** argv)
+{
+	static testCase_t testCase;
+	static testCase_t timingCases[TIMING_CASES];
+	static uint8_t expected[CAPTURE_SIZE];
+	uint32_t allowed[ALLOWED_COUNT] = { 0u };
+	long iterations = (argc > 1) ? atol(argv[1]) : 200000l;
+	long variantFailures = 0;
+	long libraryFailures = 0;
+	long iteration;
+	size_t expectedLength;
+	size_t variant;
+	uint32_t index;
+
+	/* Keep what was printed when a variant crashes */
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	if((argc > 1) && (0 == strcmp(argv[1], "-r")))
+	{
+		return replayFiles(argc - 2, &argv[2]);
+	}
+
+	if(argc > 2)
+	{
+		randomState ^= strtoull(argv[2], NULL, 0);
+	}
+
+	for(iteration = 0; iteration < iterations; iteration++)
+	{
+		expectedLength = generateCase(&testCase, expected, allowed);
+
+		variantFailures += (long)checkVariants(&testCase);
+
+		if((referenceLength != expectedLength) ||
+		   (0 != memcmp(referenceOutput, expected, expectedLength)))
+		{
+			libraryFailures++;
+			printf("FAIL snprintf: format ");
+			printEscaped(testCase.format, strlen((const char *)testCase.format));
+			printf("\n  snprintf  ");
+			printEscaped(expected, expectedLength);
+			printf("\n  reference ");
+			printEscaped(referenceOutput, referenceLength);
+			printf("\n");
+		}
+
+		if((variantFailures + libraryFailures) > 20)
+		{
+			break;
+		}
+	}
+
+	printf("embpf_diff: %ld formats, %ld variant failures, %ld snprintf failures\n",
+		   iteration, variantFailures, libraryFailures);
+	printf("allowed differences with snprintf:\n");
+	for(index = 0u; index < ALLOWED_COUNT; index++)
+	{
+		printf("  %-30s %u\n", allowedDifferenceNames[index], allowed[index]);
+	}
+
+	/* Time per call of every variant on the same formats */
+	for(index = 0u; index < TIMING_CASES; index++)
+	{
+		expectedLength = generateCase(&timingCases[index], expected, allowed);
+	}
+
+	printf("%-10s %8s\n", "variant", "ns/call");
+	for(variant = 0u; variant < VARIANT_COUNT; variant++)
+	{
+		uint32_t repeat;
+		double start = now();
+
+		for(repeat = 0u; repeat < 200u; repeat++)
+		{
+			for(index = 0u; index < TIMING_CASES; index++)
+			{
+				runVariant(&variants[variant], timingCases[index].format,
+						   timingCases[index].arguments);
+			}
+		}
+
+		printf("%-10s %8.1f\n", variants[variant].name,
+			   (now() - start) * 1e9 / (200.0 * TIMING_CASES));
+	}
+
+	return ((0 == variantFailures) && (0 == libraryFailures)) ? 0 : 1;
+}
+
+#endif /* FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
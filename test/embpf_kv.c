@@ -0,0 +1,275 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embpf_kv.c
+ *		Component	: host test of embedded_printf_kv()
+ *
+ *	embedded_printf.c is built twice with EMBPF_USE_KEY_VALUE, once with
+ *	EMBPF_USE_WORD_READS 1 and once with 0, the symbols renamed to
+ *	embpf_words_* and embpf_bytes_* (see the Makefile).
+ *
+ *	Checks:
+ *	- random event names and %s values, at every alignment, give the same
+ *	  output in both builds, and the same as the JSON escaping done here
+ *	- %d, %i and %u without width become JSON numbers; a width, any other
+ *	  specifier, or text around the tag make the value a JSON string
+ *
+ *	The strings are copied to a buffer of exactly their size, so reads beyond
+ *	the '\0' that are not confined to the aligned word show up with
+ *	-fsanitize=address.
+ *
+ *	Usage: embpf_kv [iterations] [seed]
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_port.h"
+
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Longest random string */
+#define STRING_SIZE						(48u)
+
+/*!< Size of the output capture buffer */
+#define CAPTURE_SIZE					(4096u)
+
+#define CHECK_OUTPUT(format, expected, ...)								\
+	checkOutput(__LINE__, (const uint8_t *)(format), (expected), __VA_ARGS__)
+
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+typedef void (*keyValueFunction_t)(const uint8_t *event, const uint8_t *format, ...);
+
+
+/*******************************************************************************
+ * Variants, see the Makefile
+ ******************************************************************************/
+
+void embpf_words_kv(const uint8_t *event, const uint8_t *format, ...);
+void embpf_bytes_kv(const uint8_t *event, const uint8_t *format, ...);
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static long failures;
+
+/* Output of the variant that was called last */
+static char captured[CAPTURE_SIZE];
+static size_t capturedLength;
+
+/* State of the xorshift random generator */
+static uint64_t randomState = 88172645463325252ull;
+
+
+/*******************************************************************************
+ * Host port
+ ******************************************************************************/
+
+void UART_PutChar(uint8_t character)
+{
+	if(capturedLength < (CAPTURE_SIZE - 1u))
+	{
+		captured[capturedLength++] = (char)character;
+		captured[capturedLength] = '\0';
+	}
+}
+
+uint32_t SYSTICK_GetTicks(void)
+{
+	return 0u;
+}
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static uint32_t randomNumber(void)
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return (uint32_t)randomState;
+}
+
+/* JSON escaping as embedded_printf_kv() is expected to do it */
+static size_t escape(char * output, const uint8_t * string)
+{
+	size_t length = 0u;
+
+	for(; *string; string++)
+	{
+		switch(*string)
+		{
+			case '"':  length += (size_t)sprintf(&output[length], "\\\"");	break;
+			case '\\': length += (size_t)sprintf(&output[length], "\\\\");	break;
+			case '\n': length += (size_t)sprintf(&output[length], "\\n");	break;
+			case '\r': length += (size_t)sprintf(&output[length], "\\r");	break;
+			case '\t': length += (size_t)sprintf(&output[length], "\\t");	break;
+			default:
+				if(*string < 0x20u)
+				{
+					length += (size_t)sprintf(&output[length], "\\u%04x", *string);
+				}
+				else
+				{
+					output[length++] = (char)*string;
+				}
+				break;
+		}
+	}
+	output[length] = '\0';
+
+	return length;
+}
+
+/* Random string, mostly plain text with now and then a character to escape */
+static void randomString(uint8_t * string)
+{
+	static const char special[] = "\"\\\n\r\t\x01\x1f\x7f\x80\xff";
+	uint32_t length = randomNumber() % STRING_SIZE;
+	uint32_t index;
+
+	for(index = 0u; index < length; index++)
+	{
+		switch(randomNumber() % 8u)
+		{
+			case 0:	 string[index] = (uint8_t)special[randomNumber() % (sizeof(special) - 1u)];	break;
+			case 1:	 string[index] = (uint8_t)(1u + (randomNumber() % 255u));	break;
+			default: string[index] = (uint8_t)('a' + (randomNumber() % 26u));	break;
+		}
+	}
+	string[length] = '\0';
+}
+
+/* Copies a string to the heap at 'offset' bytes after an aligned address */
+static uint8_t * placeString(const uint8_t * string, uint32_t offset, uint8_t ** block)
+{
+	size_t size = strlen((const char *)string) + 1u;
+
+	*block = malloc(offset + size);
+	if(NULL == *block)
+	{
+		abort();
+	}
+	memcpy(&(*block)[offset], string, size);
+
+	return &(*block)[offset];
+}
+
+static void checkOutput(int line, const uint8_t * format, const char * expected,
+						uint32_t value)
+{
+	static const keyValueFunction_t functions[] = { embpf_words_kv, embpf_bytes_kv };
+	static const char * const names[] = { "words", "bytes" };
+	size_t function;
+
+	for(function = 0u; function < 2u; function++)
+	{
+		capturedLength = 0u;
+		captured[0] = '\0';
+		functions[function]((const uint8_t *)"e", format, value);
+
+		if(0 != strcmp(captured, expected))
+		{
+			failures++;
+			printf("FAIL line %d %s: %s\n  expected %s  got      %s", line,
+				   names[function], (const char *)format, expected, captured);
+		}
+	}
+}
+
+
+/*******************************************************************************
+ * Test
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+	static uint8_t event[STRING_SIZE];
+	static uint8_t value[STRING_SIZE];
+	static char expected[CAPTURE_SIZE];
+	static char wordsOutput[CAPTURE_SIZE];
+	long iterations = (argc > 1) ? atol(argv[1]) : 100000l;
+	long iteration;
+	size_t length;
+
+	if(argc > 2)
+	{
+		randomState ^= strtoull(argv[2], NULL, 0);
+	}
+
+	/* Numbers and strings */
+	CHECK_OUTPUT("a=%d", "{\"event\":\"e\",\"a\":-5}\r\n", (uint32_t)-5);
+	CHECK_OUTPUT("a=%i", "{\"event\":\"e\",\"a\":7}\r\n", 7u);
+	CHECK_OUTPUT("a=%u", "{\"event\":\"e\",\"a\":4294967295}\r\n", 0xFFFFFFFFu);
+	CHECK_OUTPUT("a=%u b=x", "{\"event\":\"e\",\"a\":3,\"b\":\"x\"}\r\n", 3u);
+	CHECK_OUTPUT("a=%5d", "{\"event\":\"e\",\"a\":\"   12\"}\r\n", 12u);
+	CHECK_OUTPUT("a=%x", "{\"event\":\"e\",\"a\":\"1f\"}\r\n", 0x1Fu);
+	CHECK_OUTPUT("a=%X", "{\"event\":\"e\",\"a\":\"1F\"}\r\n", 0x1Fu);
+	CHECK_OUTPUT("a=%dms", "{\"event\":\"e\",\"a\":\"12ms\"}\r\n", 12u);
+	CHECK_OUTPUT("a=-%d", "{\"event\":\"e\",\"a\":\"-12\"}\r\n", 12u);
+	CHECK_OUTPUT("a=%c", "{\"event\":\"e\",\"a\":\"\\\"\"}\r\n", (uint32_t)'"');
+	CHECK_OUTPUT("a", "{\"event\":\"e\",\"a\":\"\"}\r\n", 0u);
+	CHECK_OUTPUT("a=%", "{\"event\":\"e\",\"a\":\"\"}\r\n", 0u);
+
+	/* Random event names and values at every alignment */
+	for(iteration = 0; iteration < iterations; iteration++)
+	{
+		uint32_t eventOffset = (uint32_t)iteration % 8u;
+		uint32_t valueOffset = ((uint32_t)iteration / 8u) % 8u;
+		uint8_t * eventBlock;
+		uint8_t * valueBlock;
+		uint8_t * placedEvent;
+		uint8_t * placedValue;
+
+		randomString(event);
+		randomString(value);
+		placedEvent = placeString(event, eventOffset, &eventBlock);
+		placedValue = placeString(value, valueOffset, &valueBlock);
+
+		length = (size_t)sprintf(expected, "{\"event\":\"");
+		length += escape(&expected[length], event);
+		length += (size_t)sprintf(&expected[length], "\",\"v\":\"<");
+		length += escape(&expected[length], value);
+		sprintf(&expected[length], ">\"}\r\n");
+
+		capturedLength = 0u;
+		embpf_words_kv(placedEvent, (const uint8_t *)"v=<%s>", placedValue);
+		memcpy(wordsOutput, captured, capturedLength + 1u);
+
+		capturedLength = 0u;
+		embpf_bytes_kv(placedEvent, (const uint8_t *)"v=<%s>", placedValue);
+
+		if((0 != strcmp(wordsOutput, captured)) || (0 != strcmp(captured, expected)))
+		{
+			if(failures++ < 10)
+			{
+				printf("FAIL offsets %u %u\n  expected %s  words    %s  bytes    %s",
+					   eventOffset, valueOffset, expected, wordsOutput, captured);
+			}
+		}
+
+		free(eventBlock);
+		free(valueBlock);
+	}
+
+	printf("embpf_kv: %ld strings, %ld failures\n", iterations, failures);
+
+	return (0 == failures) ? 0 : 1;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,268 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embpf_ratelimit.c
+ *		Component	: host test of the embedded_printf() rate limiter
+ *
+ *	Built with EMBPF_USE_RATE_LIMIT. SYSTICK_GetTicks() returns a tick count
+ *	the test sets, so every check is deterministic. To test the lock free
+ *	update, SYSTICK_GetTicks() can also act as an interrupt: right after the
+ *	tick is sampled, time moves on and a second call of the same site is made
+ *	before the first one continues.
+ *
+ *	Checks:
+ *	- the 1-in-N sampler
+ *	- the burst, and one message per ticksPerToken after it
+ *	- the cap over a longer run, with and without preemption
+ *	- the same across a wrap of the tick counter
+ *	- settings whose burst * ticksPerToken doesn't fit in 31 bits
+ *	- the summary line and the clearing of the dropped count
+ *
+ *	Usage: embpf_ratelimit
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "host_port.h"
+#include "embedded_printf.h"
+
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CHECK(condition)												\
+	do																	\
+	{																	\
+		if(!(condition))												\
+		{																\
+			printf("FAIL line %d: %s\n", __LINE__, #condition);		\
+			failures++;													\
+		}																\
+	} while(0)
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static int failures;
+
+/* Sites stay in the list of the summary once used, so each is used once */
+static embpf_rateLimit_t sites[16];
+static uint32_t siteCount;
+
+/* Output */
+static char captured[1024];
+static size_t capturedLength;
+
+/* Tick source */
+static uint32_t ticks;
+
+/* Preemption: when set, the next tick read is followed by an 'interrupt' */
+static embpf_rateLimit_t * preemptedSite;
+static uint32_t preemptTicks;
+static uint32_t preemptAllowed;
+
+
+/*******************************************************************************
+ * Host port
+ ******************************************************************************/
+
+void UART_PutChar(uint8_t character)
+{
+	if(capturedLength < (sizeof(captured) - 1u))
+	{
+		captured[capturedLength++] = (char)character;
+		captured[capturedLength] = '\0';
+	}
+}
+
+uint32_t SYSTICK_GetTicks(void)
+{
+	uint32_t sampledTicks = ticks;
+	embpf_rateLimit_t * site = preemptedSite;
+
+	if(NULL != site)
+	{
+		/* The interrupt runs a bit later and uses the same site */
+		preemptedSite = NULL;
+		ticks += preemptTicks;
+		preemptAllowed += embedded_printf_rateLimitAllow(site, (const uint8_t *)"x");
+	}
+
+	return sampledTicks;
+}
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static embpf_rateLimit_t * newSite(void)
+{
+	ASSERT(siteCount < (sizeof(sites) / sizeof(sites[0])));
+	return &sites[siteCount++];
+}
+
+/*
+ * Runs 'calls' calls per tick from 'start' for 'duration' ticks, with an
+ * interrupt every 'preemptEvery' ticks (0: none). Returns the number of
+ * messages let through, those of the interrupts included.
+ */
+static uint32_t runSite(uint32_t start, uint32_t duration, uint32_t calls,
+						uint32_t preemptEvery)
+{
+	embpf_rateLimit_t * site = newSite();
+	uint32_t allowed = 0u;
+	uint32_t call;
+
+	preemptAllowed = 0u;
+	ticks = start;
+
+	while((uint32_t)(ticks - start) < duration)
+	{
+		if((0u != preemptEvery) && (0u == ((ticks - start) % preemptEvery)))
+		{
+			preemptedSite = site;
+		}
+
+		for(call = 0u; call < calls; call++)
+		{
+			allowed += embedded_printf_rateLimitAllow(site, (const uint8_t *)"x");
+		}
+
+		ticks++;
+	}
+
+	preemptedSite = NULL;
+
+	return allowed + preemptAllowed;
+}
+
+
+/*******************************************************************************
+ * Test
+ ******************************************************************************/
+
+int main(void)
+{
+	embpf_rateLimit_t * site;
+	uint32_t allowed;
+	uint32_t call;
+	uint32_t cap;
+	uint32_t start;
+
+	/* Sampler: calls 0, 4, 8, ... pass */
+	embedded_printf_setRateLimit(4u, 0u, 1u);
+	site = newSite();
+	for(call = 0u; call < 40u; call++)
+	{
+		allowed = embedded_printf_rateLimitAllow(site, (const uint8_t *)"x");
+		CHECK(allowed == ((0u == (call % 4u)) ? 1u : 0u));
+	}
+	CHECK(30u == site->droppedCount);
+
+	/* Burst of 5, then one per 10 ticks */
+	embedded_printf_setRateLimit(1u, 10u, 5u);
+	site = newSite();
+	ticks = 1000u;
+	allowed = 0u;
+	for(call = 0u; call < 20u; call++)
+	{
+		allowed += embedded_printf_rateLimitAllow(site, (const uint8_t *)"x");
+	}
+	CHECK(5u == allowed);
+	ticks += 9u;
+	CHECK(0u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+	ticks += 1u;
+	CHECK(1u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+	CHECK(0u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+
+	/* Refilled after burst * ticksPerToken, but not beyond the burst */
+	ticks += 1000u;
+	allowed = 0u;
+	for(call = 0u; call < 20u; call++)
+	{
+		allowed += embedded_printf_rateLimitAllow(site, (const uint8_t *)"x");
+	}
+	CHECK(5u == allowed);
+
+	/*
+	 * Cap over 1000 ticks: the burst plus one per 10 ticks. An interrupt
+	 * that uses a newer tick must not hand the burst back to the call it
+	 * interrupted.
+	 */
+	cap = 5u + (1000u / 10u);
+	for(start = 0u; start < 2u; start++)
+	{
+		uint32_t origin = (0u == start) ? 50u : 0xFFFFFE00u;
+
+		allowed = runSite(origin, 1000u, 3u, 0u);
+		CHECK(allowed <= cap);
+		CHECK(allowed >= (cap - 2u));
+
+		preemptTicks = 3u;
+		allowed = runSite(origin, 1000u, 3u, 10u);
+		CHECK(allowed <= cap);
+		CHECK(allowed >= (cap - 2u));
+
+		preemptTicks = 9u;
+		allowed = runSite(origin, 1000u, 1u, 1u);
+		CHECK(allowed <= cap);
+	}
+
+	/* Settings that don't fit in 31 bits are clamped instead of wrapping */
+	embedded_printf_setRateLimit(1u, 0x40000000u, 8u);
+	site = newSite();
+	ticks = 123u;
+	CHECK(1u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+	CHECK(0u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+	ticks += 0x40000000u;
+	CHECK(1u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+	CHECK(0u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+
+	embedded_printf_setRateLimit(1u, 3u, 0xFFFFFFFFu);
+	site = newSite();
+	allowed = 0u;
+	for(call = 0u; call < 1000u; call++)
+	{
+		allowed += embedded_printf_rateLimitAllow(site, (const uint8_t *)"x");
+	}
+	CHECK(1000u == allowed);
+
+	embedded_printf_setRateLimit(1u, 0xFFFFFFFFu, 0xFFFFFFFFu);
+	site = newSite();
+	CHECK(1u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+	CHECK(0u == embedded_printf_rateLimitAllow(site, (const uint8_t *)"x"));
+
+	/* Summary: one line per site, without the line ends of the format */
+	embedded_printf_setRateLimit(1u, 10u, 2u);
+	ticks = 5000u;
+	capturedLength = 0u;
+	for(call = 0u; call < 5u; call++)
+	{
+		embedded_printf_limited((const uint8_t *)"rx %u\r\n", call);
+	}
+	CHECK(0 == strcmp(captured, "rx 0\r\nrx 1\r\n"));
+
+	capturedLength = 0u;
+	embedded_printf_rateLimitSummary();
+	CHECK(NULL != strstr(captured, "dropped 3: rx %u\r\n"));
+	CHECK(NULL == strstr(captured, "dropped 3: rx %u\r\n\r\n"));
+
+	capturedLength = 0u;
+	captured[0] = '\0';
+	embedded_printf_rateLimitSummary();
+	CHECK(NULL == strstr(captured, "rx %u"));
+
+	printf("embpf_ratelimit: %d failures\n", failures);
+
+	return (0 == failures) ? 0 : 1;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,168 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embsf_bench.c
+ *		Component	: host benchmark, embedded_sscanf() against glibc sscanf()
+ *
+ *	Times both functions on the same set of inputs and prints the time per
+ *	call and the speedup per input kind. The goal for embedded_sscanf() is to
+ *	be 10 times faster than the C library on numeric fields; the last column
+ *	shows if it is reached. Build with optimisation (e.g. -O2) on an otherwise
+ *	idle machine, the numbers are only meaningful relative to each other.
+ *
+ *	Usage: embsf_bench [calls per input]
+ *
+ */
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "embedded_scanf.h"
+
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Speedup over the C library that embedded_sscanf() aims for */
+#define SPEEDUP_GOAL					(10.0)
+
+/*!< Number of different inputs per benchmark, cycled through */
+#define INPUT_COUNT						(64u)
+
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+typedef struct
+{
+	const char * name;
+	const char * format;
+	const char * inputFormat;
+	uint32_t valueMask;
+} benchmark_t;
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const benchmark_t benchmarks[] =
+{
+	{ "%u short",		"%u",				"%u",					0x3FFu },
+	{ "%u long",		"%u",				"%u",					0xFFFFFFFFu },
+	{ "%d negative",	"%d",				"-%u",					0x7FFFFFFFu },
+	{ "%x",				"%x",				"%x",					0xFFFFFFFFu },
+	{ "%x with 0x",		"%x",				"0x%08X",				0xFFFFFFFFu },
+	{ "command line",	"set %u %x %d",		"set %u %x -17",		0xFFFFu },
+};
+
+/* Inputs and the sink that keeps the compiler from dropping the calls */
+static char inputs[INPUT_COUNT][48];
+static volatile uint32_t sink;
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static double now(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+static double timeEmbedded(const char * format, long calls)
+{
+	uint32_t values[3] = { 0u, 0u, 0u };
+	double start = now();
+	long call;
+
+	for(call = 0; call < calls; call++)
+	{
+		embedded_sscanf((const uint8_t *)inputs[call % INPUT_COUNT],
+						(const uint8_t *)format, &values[0], &values[1], &values[2]);
+		sink += values[0] + values[1] + values[2];
+	}
+
+	return (now() - start) * 1e9 / (double)calls;
+}
+
+static double timeLibrary(const char * format, long calls)
+{
+	uint32_t values[3] = { 0u, 0u, 0u };
+	double start = now();
+	long call;
+
+	for(call = 0; call < calls; call++)
+	{
+		sscanf(inputs[call % INPUT_COUNT], format, &values[0], &values[1], &values[2]);
+		sink += values[0] + values[1] + values[2];
+	}
+
+	return (now() - start) * 1e9 / (double)calls;
+}
+
+
+/*******************************************************************************
+ * Benchmark
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+	long calls = (argc > 1) ? atol(argv[1]) : 2000000l;
+	uint32_t randomState = 2463534242u;
+	uint32_t reached = 0u;
+	size_t benchmark;
+	uint32_t input;
+
+	printf("%-14s %12s %12s %9s %s\n", "input", "embedded ns", "libc ns",
+		   "speedup", "goal");
+
+	for(benchmark = 0u; benchmark < (sizeof(benchmarks) / sizeof(benchmarks[0])); benchmark++)
+	{
+		const benchmark_t * current = &benchmarks[benchmark];
+		double embedded;
+		double library;
+
+		for(input = 0u; input < INPUT_COUNT; input++)
+		{
+			uint32_t values[2];
+
+			randomState ^= randomState << 13;
+			randomState ^= randomState >> 17;
+			randomState ^= randomState << 5;
+			values[0] = randomState & current->valueMask;
+			values[1] = (randomState >> 7) & current->valueMask;
+			snprintf(inputs[input], sizeof(inputs[input]), current->inputFormat,
+					 values[0], values[1]);
+		}
+
+		/* Warm up both, then measure */
+		timeEmbedded(current->format, calls / 10);
+		timeLibrary(current->format, calls / 10);
+		embedded = timeEmbedded(current->format, calls);
+		library = timeLibrary(current->format, calls);
+
+		if((library / embedded) >= SPEEDUP_GOAL)
+		{
+			reached++;
+		}
+
+		printf("%-14s %12.1f %12.1f %8.1fx %s\n", current->name, embedded, library,
+			   library / embedded, ((library / embedded) >= SPEEDUP_GOAL) ? "met" : "not met");
+	}
+
+	printf("embsf_bench: %.0fx goal met for %u of %u inputs\n", SPEEDUP_GOAL, reached,
+		   (unsigned)(sizeof(benchmarks) / sizeof(benchmarks[0])));
+
+	return 0;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,681 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: embsf_diff.c
+ *		Component	: host test, embedded_sscanf() against glibc sscanf()
+ *
+ *	Feeds random decimal and hexadecimal fields (signs, leading zeros, 0x
+ *	prefixes, widths, trailing characters) to both embedded_sscanf() and the
+ *	C library sscanf() and compares the results. Every field is placed so its
+ *	'\0' is the last byte before a PROT_NONE page, so any read beyond the
+ *	string that is not confined to the aligned block crashes the test.
+ *
+ *	Then random formats of up to 8 tags, mixing literals, white space, %%,
+ *	numbers, %c and %s (with and without width), are read from matching input
+ *	that is now and then damaged or cut short. The return count and every
+ *	destination are compared with glibc.
+ *
+ *	Intended differences (checked explicitly, not compared):
+ *	- A number that doesn't fit in 32 bits is a mismatch for embedded_sscanf()
+ *	  (returns 0), glibc converts it anyway.
+ *	- %u does not accept a sign in embedded_sscanf().
+ *	- Input that ends before the first value: glibc returns EOF,
+ *	  embedded_sscanf() returns 0.
+ *
+ *	Usage: embsf_diff [iterations] [seed]
+ *
+ */
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "embedded_scanf.h"
+
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* State of the xorshift random generator */
+static uint64_t randomState = 88172645463325252ull;
+
+/* Page after which a PROT_NONE page follows */
+static char * guardedPage;
+static size_t pageSize;
+
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+static uint32_t randomNumber(void)
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return (uint32_t)randomState;
+}
+
+/* Copies the field so it ends right before the guard page (or a bit earlier) */
+static const char * placeField(const char * field)
+{
+	size_t length = strlen(field) + 1u;
+	char * placed = guardedPage + pageSize - length;
+
+	if(0u == (randomNumber() % 3u))
+	{
+		placed -= (randomNumber() % 16u);
+	}
+
+	memcpy(placed, field, length);
+	return placed;
+}
+
+/* Random value biased towards the interesting ranges */
+static int64_t randomValue(uint8_t isSigned)
+{
+	switch(randomNumber() % 6u)
+	{
+		case 0:	 return 0;
+		case 1:	 return randomNumber() % 1000u;
+		case 2:	 return isSigned ? INT32_MIN : 0xFFFFFFFFu;
+		case 3:	 return isSigned ? INT32_MAX : 0x80000000u;
+		case 4:	 return isSigned ? (int64_t)(int32_t)randomNumber() :
+								   (int64_t)randomNumber();
+		default: return ((int64_t)randomNumber() << 2) - 0x100000000ll;
+	}
+}
+
+/* Returns 1 when the input holds a "0x" without a hexadecimal digit after it */
+static int hasBarePrefix(const char * input)
+{
+	for(; ('\0' != input[0]) && ('\0' != input[1]); input++)
+	{
+		if(('0' == input[0]) && (('x' == input[1]) || ('X' == input[1])) &&
+		   !isxdigit((unsigned char)input[2]))
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* Reasons a multi tag format may read differently, see compareFormats() */
+#define DIFFERENCE_NONE					(0)
+#define DIFFERENCE_OVERFLOW				(1)
+#define DIFFERENCE_SIGN					(2)
+
+/*
+ * Reads the input again with glibc, with the numbers read into 64 bits and
+ * the start of every field recorded with %n. Returns DIFFERENCE_OVERFLOW when
+ * a number doesn't fit its 32 bits destination, DIFFERENCE_SIGN when the
+ * field embedded_sscanf() stopped at ('failedTag') is a %u or %x with a sign.
+ */
+static int findDifference(const char * input, const char * wideFormat,
+						  const char * tagKinds, int failedTag)
+{
+	int64_t values[8];
+	int starts[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+	int count;
+	int index;
+
+	count = sscanf(input, wideFormat,
+				   &starts[0], &values[0], &starts[1], &values[1],
+				   &starts[2], &values[2], &starts[3], &values[3],
+				   &starts[4], &values[4], &starts[5], &values[5],
+				   &starts[6], &values[6], &starts[7], &values[7]);
+
+	for(index = 0; index < count; index++)
+	{
+		if((('d' == tagKinds[index]) && ((values[index] < INT32_MIN) || (values[index] > INT32_MAX))) ||
+		   ((('u' == tagKinds[index]) || ('x' == tagKinds[index])) &&
+			((uint64_t)values[index] > 0xFFFFFFFFull)))
+		{
+			return DIFFERENCE_OVERFLOW;
+		}
+	}
+
+	if((failedTag < 8) && (starts[failedTag] >= 0) &&
+	   (('u' == tagKinds[failedTag]) || ('x' == tagKinds[failedTag])))
+	{
+		const char * field = &input[starts[failedTag]];
+
+		while(isspace((unsigned char)*field))
+		{
+			field++;
+		}
+		if(('+' == *field) || ('-' == *field))
+		{
+			return DIFFERENCE_SIGN;
+		}
+	}
+
+	return DIFFERENCE_NONE;
+}
+
+/* Appends 0 - 'maximum' white space characters */
+static size_t putWhiteSpace(char * input, uint32_t maximum)
+{
+	static const char whiteSpace[] = " \t\n";
+	uint32_t count = randomNumber() % (maximum + 1u);
+	uint32_t index;
+
+	for(index = 0u; index < count; index++)
+	{
+		input[index] = whiteSpace[randomNumber() % (sizeof(whiteSpace) - 1u)];
+	}
+
+	return count;
+}
+
+/*
+ * Random multi tag formats with matching input: literals, white space, %%,
+ * numbers, %c and %s, with and without width. Now and then the input is
+ * damaged or cut short, so reading stops part way. The return count and all
+ * destinations are compared with glibc; the destinations that are not
+ * assigned must be left alone by both.
+ *
+ * The input never lets a number run into the next field (no digits, hex
+ * letters or 'x' follow one, and white space comes before every number), as
+ * that could overflow, which is tested on single fields above.
+ *
+ * Intended differences:
+ * - where glibc returns EOF (input ends before the first value)
+ *   embedded_sscanf() returns 0
+ * - glibc assigns and counts a %c that the input ends in the middle of, C
+ *   and embedded_sscanf() treat it as a mismatch. The input is not cut
+ *   inside a %c, but it can be in what a width left of a %s, which a %c then
+ *   reads.
+ * - a sign before %u or %x, see the single field test. The damage never puts
+ *   a '-' in the input, but it can shift the fields so that one with a sign
+ *   is read by %u or %x.
+ * - a number that doesn't fit in 32 bits, see the single field test. Damage
+ *   can shift the fields so that one is read as a number. Checked by reading
+ *   the numbers into 64 bits with glibc.
+ * - "0x" without a hexadecimal digit after it: embedded_sscanf() reads the
+ *   0 and stops at the 'x' (like strtoul()), glibc also takes the 'x'. Inputs
+ *   holding a bare "0x" may differ; they are counted, not compared.
+ */
+static long compareFormats(long iterations, long * endOfInputCount,
+						   long * barePrefixCount, long * shortCharacterCount,
+						   long * overflowCount, long * signCount)
+{
+	static const char literals[] = ":=,;-/";
+	static const char text[] = "!#&*;[]~ghkmnprtvwyzGHKQ";
+	static const char damage[] = " %:;\t";
+	long failures = 0;
+	long iteration;
+
+	for(iteration = 0; iteration < iterations; iteration++)
+	{
+		char format[128];
+		char referenceFormat[128];
+		char wideFormat[192];
+		char tagKinds[8];
+		uint8_t isCut = 0u;
+		char input[256];
+		uint8_t slots[8][32];
+		uint8_t referenceSlots[8][32];
+		size_t formatLength = 0u;
+		size_t referenceLength = 0u;
+		size_t wideLength = 0u;
+		size_t inputLength = 0u;
+		uint32_t tagCount = 0u;
+		size_t characterStart[8];
+		size_t characterEnd[8];
+		uint32_t characterCount = 0u;
+		uint32_t index;
+		int difference;
+		int resultCount;
+		int referenceCount;
+		const char * placed;
+
+		while((tagCount < 8u) && (0u != (randomNumber() % 8u)))
+		{
+			char tag[8] = "";
+			char field[48];
+			uint32_t width = 0u;
+			int length = 0;
+			int index;
+
+			switch(randomNumber() % 8u)
+			{
+				case 0:
+					format[formatLength++] = literals[randomNumber() % (sizeof(literals) - 1u)];
+					input[inputLength++] = format[formatLength - 1u];
+					referenceFormat[referenceLength++] = format[formatLength - 1u];
+					wideFormat[wideLength++] = format[formatLength - 1u];
+					continue;
+
+				case 1:
+					format[formatLength++] = (randomNumber() & 1u) ? ' ' : '\t';
+					referenceFormat[referenceLength++] = format[formatLength - 1u];
+					wideFormat[wideLength++] = format[formatLength - 1u];
+					inputLength += putWhiteSpace(&input[inputLength], 3u);
+					continue;
+
+				case 2:
+					memcpy(&format[formatLength], "%%", 2u);
+					memcpy(&referenceFormat[referenceLength], "%%", 2u);
+					memcpy(&wideFormat[wideLength], "%%", 2u);
+					formatLength += 2u;
+					referenceLength += 2u;
+					wideLength += 2u;
+					inputLength += putWhiteSpace(&input[inputLength], 1u);
+					input[inputLength++] = '%';
+					continue;
+
+				case 3:
+				{
+					/*
+					 * %c: exactly 'width' characters. The first is no white
+					 * space, as white space in the format before it would
+					 * skip it.
+					 */
+					width = randomNumber() % 5u;
+					characterStart[characterCount] = inputLength;
+					for(index = 0; index < (int)((0u == width) ? 1u : width); index++)
+					{
+						input[inputLength++] = ((0 != index) && (0u == (randomNumber() % 4u))) ?
+											   ' ' : text[randomNumber() % (sizeof(text) - 1u)];
+					}
+					characterEnd[characterCount++] = inputLength;
+					sprintf(tag, "c");
+					break;
+				}
+
+				case 4:
+				{
+					/* %s: a word, either cut by the width or ended by white space */
+					uint32_t wordLength = 1u + (randomNumber() % 12u);
+
+					inputLength += putWhiteSpace(&input[inputLength], 2u);
+					for(index = 0; index < (int)wordLength; index++)
+					{
+						input[inputLength++] = text[randomNumber() % (sizeof(text) - 1u)];
+					}
+					width = (randomNumber() & 1u) ? (1u + (randomNumber() % 16u)) : 0u;
+					sprintf(tag, "s");
+					break;
+				}
+
+				default:
+				{
+					/* A number, written like in the single field test */
+					static const char numbers[] = "diuxX";
+					char specifier = numbers[randomNumber() % (sizeof(numbers) - 1u)];
+					int64_t value = randomValue(('d' == specifier) || ('i' == specifier));
+					uint32_t zeros = (0u == (randomNumber() % 4u)) ? randomNumber() % 4u : 0u;
+
+					if(('d' == specifier) || ('i' == specifier))
+					{
+						if(value < 0)
+						{
+							field[length++] = '-';
+							value = -value;
+						}
+						else if(0u == (randomNumber() % 5u))
+						{
+							field[length++] = '+';
+						}
+					}
+					else if(value < 0)
+					{
+						value = -value;
+					}
+					if((value > 0xFFFFFFFFll) ||
+					   ((('d' == specifier) || ('i' == specifier)) && (value > 0x80000000ll)))
+					{
+						value = 12345;
+					}
+					if(('x' == specifier) || ('X' == specifier))
+					{
+						if(0u == (randomNumber() % 3u))
+						{
+							field[length++] = '0';
+							field[length++] = 'x';
+						}
+					}
+					while(zeros--)
+					{
+						field[length++] = '0';
+					}
+					length += sprintf(&field[length],
+									  (('x' == specifier) || ('X' == specifier)) ? "%llX" : "%lld",
+									  (long long)value);
+					if((('d' == specifier) || ('i' == specifier)) && ('-' != field[0]) &&
+					   (value > 0x7FFFFFFFll))
+					{
+						/* Only -2147483648 may use the largest magnitude */
+						length = sprintf(field, "2147483647");
+					}
+
+					/* A width, if any, never cuts the number */
+					if(randomNumber() & 1u)
+					{
+						width = (uint32_t)length + (randomNumber() % 3u);
+					}
+
+					/* At least 1 white space, so it can't join a number before it */
+					input[inputLength++] = ' ';
+					inputLength += putWhiteSpace(&input[inputLength], 1u);
+					memcpy(&input[inputLength], field, (size_t)length);
+					inputLength += (size_t)length;
+					sprintf(tag, "%c", specifier);
+					break;
+				}
+			}
+
+			/*
+			 * Write the tag. glibc reads %i as 'any base' so it gets %d. The
+			 * wide format reads the numbers into 64 bits, to find overflows.
+			 */
+			switch(tag[0])
+			{
+				case 'd':
+				case 'i': tagKinds[tagCount] = 'd';		break;
+				case 'x':
+				case 'X': tagKinds[tagCount] = 'x';		break;
+				default:  tagKinds[tagCount] = tag[0];	break;
+			}
+			{
+				char widthText[12] = "";
+				const char * wideTag = ('d' == tagKinds[tagCount]) ? "lld" :
+									   (('u' == tagKinds[tagCount]) ? "llu" :
+									   (('x' == tagKinds[tagCount]) ? "llx" : tag));
+
+				if(width)
+				{
+					sprintf(widthText, "%u", width);
+				}
+				formatLength += (size_t)sprintf(&format[formatLength], "%%%s%s", widthText, tag);
+				referenceLength += (size_t)sprintf(&referenceFormat[referenceLength], "%%%s%s",
+												   widthText, ('i' == tag[0]) ? "d" : tag);
+				wideLength += (size_t)sprintf(&wideFormat[wideLength], "%%n%%%s%s", widthText, wideTag);
+			}
+
+			/* An unbounded %s needs white space after it */
+			if(('s' == tag[0]) && (0u == width))
+			{
+				format[formatLength++] = ' ';
+				referenceFormat[referenceLength++] = ' ';
+				wideFormat[wideLength++] = ' ';
+				input[inputLength++] = ' ';
+			}
+			tagCount++;
+		}
+		format[formatLength] = '\0';
+		referenceFormat[referenceLength] = '\0';
+		wideFormat[wideLength] = '\0';
+
+		/* Some input the format doesn't read, so only a cut ends it early */
+		memcpy(&input[inputLength], "~~~~~~~~~~~~~~~~", 16u);
+		inputLength += 16u;
+
+		/* Damage or cut the input now and then */
+		if((inputLength > 0u) && (0u == (randomNumber() % 4u)))
+		{
+			input[randomNumber() % inputLength] = damage[randomNumber() % (sizeof(damage) - 1u)];
+		}
+		if((inputLength > 0u) && (0u == (randomNumber() % 8u)))
+		{
+			inputLength = randomNumber() % inputLength;
+			isCut = 1u;
+
+			/* Not inside a %c, see above */
+			for(index = 0u; index < characterCount; index++)
+			{
+				if((inputLength > characterStart[index]) && (inputLength < characterEnd[index]))
+				{
+					inputLength = characterStart[index];
+				}
+			}
+		}
+		input[inputLength] = '\0';
+
+		placed = placeField(input);
+		memset(slots, 0xA5, sizeof(slots));
+		memset(referenceSlots, 0xA5, sizeof(referenceSlots));
+
+		resultCount = embedded_sscanf((const uint8_t *)placed, (const uint8_t *)format,
+									  slots[0], slots[1], slots[2], slots[3],
+									  slots[4], slots[5], slots[6], slots[7]);
+		referenceCount = sscanf(placed, referenceFormat,
+								referenceSlots[0], referenceSlots[1], referenceSlots[2],
+								referenceSlots[3], referenceSlots[4], referenceSlots[5],
+								referenceSlots[6], referenceSlots[7]);
+
+		if(EOF == referenceCount)
+		{
+			(*endOfInputCount)++;
+			referenceCount = 0;
+		}
+
+		if((resultCount != referenceCount) ||
+		   (0 != memcmp(slots, referenceSlots, sizeof(slots))))
+		{
+			if(hasBarePrefix(placed))
+			{
+				(*barePrefixCount)++;
+			}
+			else if(isCut && (resultCount < referenceCount) &&
+					('c' == tagKinds[resultCount]))
+			{
+				(*shortCharacterCount)++;
+			}
+			else if(DIFFERENCE_OVERFLOW ==
+					(difference = findDifference(placed, wideFormat, tagKinds, resultCount)))
+			{
+				(*overflowCount)++;
+			}
+			else if(DIFFERENCE_SIGN == difference)
+			{
+				(*signCount)++;
+			}
+			else if(failures++ < 10)
+			{
+				printf("FAIL format \"%s\" input \"%s\": embedded %d, libc %d\n",
+					   format, placed, resultCount, referenceCount);
+			}
+		}
+	}
+
+	return failures;
+}
+
+
+/*******************************************************************************
+ * Test
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+	long iterations = (argc > 1) ? atol(argv[1]) : 2000000l;
+	long failures = 0;
+	long compared = 0;
+	long overflows = 0;
+	long formatFailures;
+	long endOfInputCount = 0;
+	long barePrefixCount = 0;
+	long shortCharacterCount = 0;
+	long formatOverflows = 0;
+	long formatSigns = 0;
+	long iteration;
+
+	if(argc > 2)
+	{
+		randomState ^= strtoull(argv[2], NULL, 0);
+	}
+
+	pageSize = (size_t)sysconf(_SC_PAGESIZE);
+	guardedPage = mmap(NULL, 2u * pageSize, PROT_READ | PROT_WRITE,
+					   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if((MAP_FAILED == guardedPage) ||
+	   (0 != mprotect(guardedPage + pageSize, pageSize, PROT_NONE)))
+	{
+		perror("mmap");
+		return 2;
+	}
+
+	for(iteration = 0; iteration < iterations; iteration++)
+	{
+		char field[64];
+		char format[16];
+		char referenceFormat[16];
+		char widthText[8] = "";
+		const char * input;
+		const char * trailers = " g:,-x";
+		uint32_t kind = randomNumber() % 3u;
+		uint32_t zeros = (0u == (randomNumber() % 4u)) ? randomNumber() % 12u : 0u;
+		uint32_t width = (0u == (randomNumber() % 4u)) ? 1u + randomNumber() % 12u : 0u;
+		int64_t value = randomValue(0u == kind);
+		long long wideResult = 0;
+		uint32_t result = 0xDEADBEEFu;
+		uint32_t reference = 0xDEADBEEFu;
+		int resultCount;
+		int referenceCount;
+		int wideCount;
+		int isInRange;
+		int position = 0;
+		char specifier;
+
+		/* Build the field */
+		if(0u == kind)
+		{
+			specifier = (randomNumber() & 1u) ? 'd' : 'i';
+			if(value < 0)
+			{
+				field[position++] = '-';
+				value = -value;
+			}
+			else if(0u == (randomNumber() % 5u))
+			{
+				field[position++] = '+';
+			}
+		}
+		else if(1u == kind)
+		{
+			specifier = 'u';
+			if(value < 0)
+			{
+				value = -value;
+			}
+		}
+		else
+		{
+			specifier = (randomNumber() & 1u) ? 'x' : 'X';
+			if(value < 0)
+			{
+				value = -value;
+			}
+			if(0u == (randomNumber() % 3u))
+			{
+				field[position++] = '0';
+				field[position++] = (randomNumber() & 1u) ? 'x' : 'X';
+			}
+		}
+
+		while(zeros--)
+		{
+			field[position++] = '0';
+		}
+
+		position += sprintf(&field[position],
+							(2u == kind) ? ((randomNumber() & 1u) ? "%llx" : "%llX") :
+										   "%lld",
+							(long long)value);
+
+		if(randomNumber() & 1u)
+		{
+			field[position++] = trailers[randomNumber() % strlen(trailers)];
+		}
+		field[position] = '\0';
+
+		/* Formats: glibc reads %i as 'any base', so it gets %d instead */
+		if(width)
+		{
+			sprintf(widthText, "%u", width);
+		}
+		sprintf(format, "%%%s%c", widthText, specifier);
+		sprintf(referenceFormat, "%%%s%c", widthText,
+				('i' == specifier) ? 'd' : specifier);
+
+		input = placeField(field);
+		resultCount = embedded_sscanf((const uint8_t *)input,
+									  (const uint8_t *)format, &result);
+
+		/* Find out if the field fits in 32 bits, using a 64 bits read */
+		{
+			char wideFormat[16];
+			sprintf(wideFormat, "%%%sll%c", widthText,
+					(0u == kind) ? 'd' : ((1u == kind) ? 'u' : 'x'));
+			wideCount = sscanf(input, wideFormat, &wideResult);
+		}
+
+		if(0u == kind)
+		{
+			isInRange = (wideResult >= INT32_MIN) && (wideResult <= INT32_MAX);
+		}
+		else
+		{
+			isInRange = ((unsigned long long)wideResult <= 0xFFFFFFFFull);
+		}
+
+		if((1 == wideCount) && !isInRange)
+		{
+			/* Intended difference: no truncation, the field doesn't match */
+			overflows++;
+			if(0 != resultCount)
+			{
+				if(failures++ < 10)
+				{
+					printf("FAIL overflow \"%s\" %s: returned %d (%u)\n",
+						   input, format, resultCount, result);
+				}
+			}
+			continue;
+		}
+
+		referenceCount = sscanf(input, referenceFormat, &reference);
+		compared++;
+
+		if((resultCount != referenceCount) ||
+		   ((1 == resultCount) && (result != reference)))
+		{
+			if(failures++ < 10)
+			{
+				printf("FAIL \"%s\" %s: embedded %d %u, libc %d %u\n",
+					   input, format, resultCount, result,
+					   referenceCount, reference);
+			}
+		}
+	}
+
+	printf("embsf_diff: %ld fields, %ld compared with libc, %ld overflows, "
+		   "%ld failures\n", iterations, compared, overflows, failures);
+
+	formatFailures = compareFormats(iterations / 4, &endOfInputCount, &barePrefixCount,
+									&shortCharacterCount, &formatOverflows, &formatSigns);
+
+	printf("embsf_diff: %ld formats, %ld failures\n", iterations / 4, formatFailures);
+	printf("allowed differences with libc:\n"
+		   "  input ends before the first value (EOF)  %ld\n"
+		   "  bare 0x                                  %ld\n"
+		   "  %%c cut short by the end of the input     %ld\n"
+		   "  number doesn't fit in 32 bits            %ld\n"
+		   "  sign before %%u or %%x                     %ld\n",
+		   endOfInputCount, barePrefixCount, shortCharacterCount, formatOverflows,
+		   formatSigns);
+
+	return ((0 == failures) && (0 == formatFailures)) ? 0 : 1;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
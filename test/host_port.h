@@ -0,0 +1,27 @@
+/*
+ * 		Copyright (C) 2026, Christean van der Mijden and Heart of Technology
+ * 		All rights reserved.
+ *
+ *		Filename   	: host_port.h
+ *		Component	: host test port of embedded printf
+ *
+ *	Provides what embedded_printf.h expects from the application when the
+ *	library is built on the development machine: ASSERT and the output and
+ *	tick functions the macros embedded_putChar() and embedded_getTicks() map
+ *	to. It is passed to the compiler with -include, so the library sources are
+ *	built unchanged. The test itself defines UART_PutChar() and
+ *	SYSTICK_GetTicks().
+ *
+ */
+#ifndef HOST_PORT_H_
+#define HOST_PORT_H_
+
+#include <assert.h>
+#include <stdint.h>
+
+#define ASSERT(x)						assert(x)
+
+void UART_PutChar(uint8_t character);
+uint32_t SYSTICK_GetTicks(void);
+
+#endif /* HOST_PORT_H_ */
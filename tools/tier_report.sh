@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Builds embedded_printf.c once per tier and prints a table with the section
+# sizes of the object file and the time per call of test/embpf_bench.c.
+#
+# The sizes are measured with CC and SIZE, so point them at the target
+# toolchain to get target numbers:
+#
+#   CC=arm-none-eabi-gcc SIZE=arm-none-eabi-size \
+#   TARGET_CFLAGS="-Os -mcpu=cortex-m4 -mthumb" tools/tier_report.sh
+#
+# The benchmark always runs on the development machine and is built with
+# HOST_CC. Extra options for both builds (e.g. -DEMBPF_USE_KEY_VALUE=1) can be
+# given as arguments.
+#
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+SOURCE="$ROOT/embedded_printf"
+CC=${CC:-gcc}
+SIZE=${SIZE:-size}
+HOST_CC=${HOST_CC:-gcc}
+TARGET_CFLAGS=${TARGET_CFLAGS:--Os}
+HOST_CFLAGS=${HOST_CFLAGS:--O2}
+CALLS=${CALLS:-2000000}
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# Sum of the sizes of all sections starting with $2 in the 'size -A' output $1
+section_size()
+{
+	awk -v prefix="$2" 'index($1, prefix) == 1 { total += $2 } END { print total + 0 }' "$1"
+}
+
+printf '%-8s %8s %8s %8s %8s\n' "tier" ".text" ".rodata" ".data" "ns/call"
+
+for TIER in MINIMAL DEFAULT FAST
+do
+	"$CC" $TARGET_CFLAGS -std=gnu99 -include "$ROOT/test/host_port.h" \
+		-I"$SOURCE" -DEMBPF_TIER=EMBPF_TIER_$TIER "$@" \
+		-c "$SOURCE/embedded_printf.c" -o "$WORK/$TIER.o"
+	"$SIZE" -A "$WORK/$TIER.o" > "$WORK/$TIER.size"
+
+	"$HOST_CC" $HOST_CFLAGS -std=gnu99 -include "$ROOT/test/host_port.h" \
+		-I"$ROOT/test" -I"$SOURCE" -DEMBPF_TIER=EMBPF_TIER_$TIER "$@" \
+		"$ROOT/test/embpf_bench.c" "$SOURCE/embedded_printf.c" -o "$WORK/bench_$TIER"
+
+	printf '%-8s %8s %8s %8s %8s\n' "$TIER" \
+		"$(section_size "$WORK/$TIER.size" .text)" \
+		"$(section_size "$WORK/$TIER.size" .rodata)" \
+		"$(section_size "$WORK/$TIER.size" .data)" \
+		"$("$WORK/bench_$TIER" "$CALLS")"
+done